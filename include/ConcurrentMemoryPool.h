@@ -0,0 +1,68 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <stdexcept>
+#include "PoolTraits.h"
+#include "TaggedIndexStack.h"
+
+// Thread-safe counterpart of MemoryPool<T>.
+// Slots live in one contiguous slab exactly as in MemoryPool, but the free
+// list is a lock-free tagged-index stack, so any thread may allocate or
+// deallocate without external locking.
+template <typename T>
+class ConcurrentMemoryPool {
+public:
+    // Constructor: allocates the slab and links every slot into the free list
+    explicit ConcurrentMemoryPool(size_t poolSize);
+
+    // Destructor: deallocates the slab and link array
+    ~ConcurrentMemoryPool();
+
+    ConcurrentMemoryPool(const ConcurrentMemoryPool&) = delete;
+    ConcurrentMemoryPool& operator=(const ConcurrentMemoryPool&) = delete;
+
+    // Allocate memory for an object of type T; returns nullptr when exhausted
+    T* allocate();
+
+    // Free memory and return it to the pool; callable from any thread
+    void deallocate(T* ptr);
+
+    // Return n objects at once with a single update of the free list; every
+    // pointer must belong to this pool, otherwise nothing is freed and
+    // std::invalid_argument is thrown
+    void deallocateN(T* const* ptrs, size_t n);
+
+    // Check whether a pointer lies inside this pool's slab
+    bool owns(const T* ptr) const {
+        return reinterpret_cast<uintptr_t>(ptr) - reinterpret_cast<uintptr_t>(memoryPool) < poolSize * objectSize;
+    }
+
+    // Get the total pool size
+    size_t getPoolSize() const { return poolSize; }
+
+    // Get the number of available slots (a snapshot under concurrent use)
+    size_t getAvailableSlots() const { return availableSlots.load(std::memory_order_relaxed); }
+
+    // Check if pool is full
+    bool isFull() const { return getAvailableSlots() == 0; }
+
+    // Check if pool is empty
+    bool isEmpty() const { return getAvailableSlots() == poolSize; }
+
+private:
+    char* memoryPool;                       // Raw memory pool
+    std::atomic<uint32_t>* nextLinks;       // Free-list link for each slot
+    size_t poolSize;                        // Total number of objects in pool
+
+    // Shared mutable state, each on its own cache line
+    alignas(cacheLineSize) TaggedIndexStack freeStack;
+    alignas(cacheLineSize) std::atomic<size_t> availableSlots;
+
+    // Size of each object
+    static constexpr size_t objectSize = sizeof(T);
+};
+
+#include "ConcurrentMemoryPool.hpp"
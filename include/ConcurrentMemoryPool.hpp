@@ -0,0 +1,91 @@
+#pragma once
+
+template <typename T>
+ConcurrentMemoryPool<T>::ConcurrentMemoryPool(size_t poolSize)
+    : poolSize(poolSize), availableSlots(poolSize) {
+
+    if (poolSize == 0) {
+        throw std::invalid_argument("Pool size must be greater than 0");
+    }
+    if (poolSize >= TaggedIndexStack::nullIndex) {
+        throw std::invalid_argument("Pool size must fit in a 32-bit slot index");
+    }
+
+    // Allocate raw memory pool
+    memoryPool = static_cast<char*>(std::malloc(poolSize * objectSize));
+
+    // Allocate free-list links
+    nextLinks = static_cast<std::atomic<uint32_t>*>(
+        std::malloc(poolSize * sizeof(std::atomic<uint32_t>)));
+
+    if (memoryPool == nullptr || nextLinks == nullptr) {
+        std::free(memoryPool);
+        std::free(nextLinks);
+        throw std::bad_alloc();
+    }
+
+    for (size_t i = 0; i < poolSize; ++i) {
+        new (&nextLinks[i]) std::atomic<uint32_t>(0);
+    }
+    freeStack.initialize(nextLinks, static_cast<uint32_t>(poolSize));
+}
+
+template <typename T>
+ConcurrentMemoryPool<T>::~ConcurrentMemoryPool() {
+    std::free(memoryPool);
+    std::free(nextLinks);
+}
+
+template <typename T>
+T* ConcurrentMemoryPool<T>::allocate() {
+    uint32_t index = freeStack.pop(nextLinks);
+    if (index == TaggedIndexStack::nullIndex) {
+        return nullptr; // Pool is full
+    }
+
+    availableSlots.fetch_sub(1, std::memory_order_relaxed);
+    return reinterpret_cast<T*>(memoryPool + index * objectSize);
+}
+
+template <typename T>
+void ConcurrentMemoryPool<T>::deallocate(T* ptr) {
+    if (ptr == nullptr) {
+        return;
+    }
+
+    // Validate that the pointer belongs to this pool
+    char* bytes = static_cast<char*>(static_cast<void*>(ptr));
+    if (bytes < memoryPool || bytes >= memoryPool + poolSize * objectSize) {
+        throw std::invalid_argument("Pointer does not belong to this memory pool");
+    }
+
+    size_t offset = static_cast<size_t>(bytes - memoryPool) / objectSize;
+    availableSlots.fetch_add(1, std::memory_order_relaxed);
+    freeStack.push(nextLinks, static_cast<uint32_t>(offset));
+}
+
+template <typename T>
+void ConcurrentMemoryPool<T>::deallocateN(T* const* ptrs, size_t n) {
+    if (n == 0) {
+        return;
+    }
+
+    // Validate the whole batch before touching the free list
+    bool valid = true;
+    for (size_t i = 0; i < n; ++i) {
+        valid &= owns(ptrs[i]);
+    }
+    if (!valid) {
+        throw std::invalid_argument("Pointer does not belong to this memory pool");
+    }
+
+    // Link the batch privately, then publish it with one CAS
+    auto indexOf = [this](const T* ptr) {
+        return static_cast<uint32_t>((reinterpret_cast<const char*>(ptr) - memoryPool) / objectSize);
+    };
+    for (size_t i = 0; i + 1 < n; ++i) {
+        nextLinks[indexOf(ptrs[i])].store(indexOf(ptrs[i + 1]), std::memory_order_relaxed);
+    }
+    availableSlots.fetch_add(n, std::memory_order_relaxed);
+    freeStack.pushChain(nextLinks, indexOf(ptrs[0]), indexOf(ptrs[n - 1]));
+}
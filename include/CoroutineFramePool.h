@@ -0,0 +1,159 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+#include "ConcurrentMemoryPool.h"
+#include "PoolBlock.h"
+#include "SizeClassPool.h"
+
+// Pooled allocation of C++20 coroutine frames.
+//
+// A promise type opts in by deriving from PooledCoroutineFrame:
+//
+//   struct promise_type : PooledCoroutineFrame<> { ... };
+//
+// The compiler then allocates the coroutine's frame through the mix-in's
+// operator new, passing the frame size, and frees it through the sized
+// operator delete. Frames are routed to a fixed-size pool per size class;
+// frames larger than the largest class, or arriving when their class is
+// exhausted, go to the global ::operator new.
+
+// Frame size classes: 64-byte steps up to 512, then wider steps to 4096
+inline constexpr size_t coroutineFrameClassBytes[] = {
+    64, 128, 192, 256, 320, 384, 448, 512, 768, 1024, 1536, 2048, 3072, 4096
+};
+
+// Frames from lock-free ConcurrentMemoryPools shared by all threads, so a
+// coroutine may be created on one thread and destroyed on another.
+// Every class holds FramesPerClass frames. A class's pool is created the
+// first time a frame of that size is allocated, so only the classes a
+// program actually uses cost memory.
+template <size_t FramesPerClass = 1024>
+class ConcurrentFrameSource {
+public:
+    static constexpr size_t classCount = std::size(coroutineFrameClassBytes);
+    static constexpr size_t maxFrameSize = coroutineFrameClassBytes[classCount - 1];
+
+    static void* allocate(size_t size) {
+        if (size <= maxFrameSize) {
+            const size_t frameClass = classTable[(size + granule - 1) / granule];
+            if (void* frame = allocateFns[frameClass]()) {
+                return frame;
+            }
+        }
+        return ::operator new(size);
+    }
+
+    static void deallocate(void* frame, size_t size) {
+        if (size <= maxFrameSize) {
+            const size_t frameClass = classTable[(size + granule - 1) / granule];
+            if (deallocateFns[frameClass](frame)) {
+                return;
+            }
+        }
+        ::operator delete(frame, size);
+    }
+
+    // Get the number of pooled frames left in the class serving size bytes
+    static size_t getAvailableFrames(size_t size) {
+        return availableFns[classTable[(size + granule - 1) / granule]]();
+    }
+
+private:
+    static constexpr size_t granule = 64;
+
+    // classTable[i] is the smallest class holding i * granule bytes
+    static constexpr auto classTable = [] {
+        std::array<uint8_t, maxFrameSize / granule + 1> table{};
+        size_t frameClass = 0;
+        for (size_t i = 0; i < table.size(); ++i) {
+            while (coroutineFrameClassBytes[frameClass] < i * granule) {
+                ++frameClass;
+            }
+            table[i] = static_cast<uint8_t>(frameClass);
+        }
+        return table;
+    }();
+
+    template <size_t Class>
+    using ClassPool = ConcurrentMemoryPool<PoolBlock<coroutineFrameClassBytes[Class]>>;
+
+    // Created on first use of the class
+    template <size_t Class>
+    static ClassPool<Class>& poolFor() {
+        static ClassPool<Class> instance(FramesPerClass);
+        return instance;
+    }
+
+    // Per-class entry points, gathered into jump tables indexed by class
+    template <size_t Class>
+    static void* allocateIn() {
+        return poolFor<Class>().allocate();
+    }
+
+    template <size_t Class>
+    static bool deallocateIn(void* frame) {
+        auto& pool = poolFor<Class>();
+        auto* block = static_cast<PoolBlock<coroutineFrameClassBytes[Class]>*>(frame);
+        if (!pool.owns(block)) {
+            return false;
+        }
+        pool.deallocate(block);
+        return true;
+    }
+
+    template <size_t Class>
+    static size_t availableIn() {
+        return poolFor<Class>().getAvailableSlots();
+    }
+
+    template <size_t... Classes>
+    static constexpr auto makeAllocateFns(std::index_sequence<Classes...>) {
+        return std::array<void* (*)(), classCount>{&allocateIn<Classes>...};
+    }
+
+    template <size_t... Classes>
+    static constexpr auto makeDeallocateFns(std::index_sequence<Classes...>) {
+        return std::array<bool (*)(void*), classCount>{&deallocateIn<Classes>...};
+    }
+
+    template <size_t... Classes>
+    static constexpr auto makeAvailableFns(std::index_sequence<Classes...>) {
+        return std::array<size_t (*)(), classCount>{&availableIn<Classes>...};
+    }
+
+    static constexpr auto allocateFns = makeAllocateFns(std::make_index_sequence<classCount>());
+    static constexpr auto deallocateFns = makeDeallocateFns(std::make_index_sequence<classCount>());
+    static constexpr auto availableFns = makeAvailableFns(std::make_index_sequence<classCount>());
+};
+
+// Frames from a SizeClassPool owned by each thread: no atomics on the hot
+// path, but every coroutine must be destroyed on the thread that created it.
+// Each thread reserves BytesPerClass for every size class of the pool on
+// first use; pages are only touched as frames are handed out.
+template <size_t BytesPerClass = size_t{64} << 10>
+struct ThreadLocalFrameSource {
+    static void* allocate(size_t size) {
+        void* frame = pool().allocate(size);
+        if (frame == nullptr) {
+            throw std::bad_alloc();
+        }
+        return frame;
+    }
+
+    static void deallocate(void* frame, size_t size) { pool().deallocate(frame, size); }
+
+    static SizeClassPool<>& pool() {
+        thread_local SizeClassPool<> instance(BytesPerClass);
+        return instance;
+    }
+};
+
+// Promise mix-in routing frame allocation to Source
+template <typename Source = ConcurrentFrameSource<>>
+struct PooledCoroutineFrame {
+    static void* operator new(size_t size) { return Source::allocate(size); }
+    static void operator delete(void* frame, size_t size) { Source::deallocate(frame, size); }
+};
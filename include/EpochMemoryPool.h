@@ -0,0 +1,145 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "ConcurrentMemoryPool.h"
+#include "PoolTraits.h"
+
+// ConcurrentMemoryPool with epoch-based deferred reclamation, for objects
+// reached by lock-free readers (hash maps, lists, trees built on the pool).
+//
+// Readers wrap every access to shared objects in a critical section,
+// enter() ... exit() or an EpochMemoryPool::Guard. A writer that unlinks an
+// object calls retire(ptr) rather than destroy(ptr): the object goes on the
+// calling thread's limbo list and is destroyed and freed only after every
+// critical section that could still see it has ended. Entering and leaving
+// a critical section touch only the calling thread's own record; the
+// global epoch advances when every thread inside a critical section has
+// observed the current one, and an object retired in epoch e is freed once
+// the epoch reaches e + 2.
+//
+// Each thread gets a record on first use. A thread that stops using the
+// pool should call detachThread() so its record, and any objects it has
+// retired but not yet freed, pass to the next thread that attaches.
+template <typename T>
+class EpochMemoryPool {
+public:
+    // RAII critical section
+    class Guard {
+    public:
+        explicit Guard(EpochMemoryPool& pool) : pool(pool) { pool.enter(); }
+        ~Guard() { pool.exit(); }
+
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+
+    private:
+        EpochMemoryPool& pool;
+    };
+
+    // Constructor: allocates the underlying concurrent pool
+    explicit EpochMemoryPool(size_t poolSize);
+
+    // Destructor: destroys retired objects that were never freed and
+    // releases the thread records; live objects are not destroyed
+    ~EpochMemoryPool();
+
+    EpochMemoryPool(const EpochMemoryPool&) = delete;
+    EpochMemoryPool& operator=(const EpochMemoryPool&) = delete;
+
+    // Allocate memory for an object of type T. When the pool is exhausted,
+    // tries to advance the epoch and free the calling thread's retired
+    // objects first; returns nullptr if that does not help.
+    T* allocate();
+
+    // Free memory at once; only safe when no reader can still hold ptr
+    void deallocate(T* ptr);
+
+    // Allocate and construct an object
+    template <typename... Args>
+    T* create(Args&&... args);
+
+    // Destroy an object made by create() and free its slot at once
+    void destroy(T* ptr);
+
+    // Destroy and free an unlinked object once no critical section that
+    // might have seen it is still running
+    void retire(T* ptr);
+
+    // Begin / end a read-side critical section; may be nested
+    void enter();
+    void exit();
+
+    // Try to advance the epoch, then free the calling thread's retired
+    // objects that have become safe; returns the number freed
+    size_t collect();
+
+    // Hand the calling thread's record back to the pool. Must not be
+    // called inside a critical section.
+    void detachThread();
+
+    // Get the current global epoch
+    uint64_t getEpoch() const { return globalEpoch.load(std::memory_order_relaxed); }
+
+    // Get the total pool size
+    size_t getPoolSize() const { return pool.getPoolSize(); }
+
+    // Get the number of available slots; retired objects still count as used
+    size_t getAvailableSlots() const { return pool.getAvailableSlots(); }
+
+    // Check if pool is full
+    bool isFull() const { return pool.isFull(); }
+
+    // Check if pool is empty
+    bool isEmpty() const { return pool.isEmpty(); }
+
+private:
+    // Retired objects wait in one of three buckets, by epoch modulo 3
+    static constexpr size_t limboBuckets = 3;
+
+    // Retires between attempts to advance the epoch
+    static constexpr unsigned advanceInterval = 64;
+
+    // Per-thread state. Only the owning thread touches anything but state
+    // and inUse; records are never freed before the pool.
+    struct alignas(cacheLineSize) ThreadRecord {
+        std::atomic<uint64_t> state{0};         // (epoch << 1) | 1 inside a critical section, else 0
+        std::atomic<bool> inUse{true};          // Owned by a thread
+        ThreadRecord* next = nullptr;           // Next record; fixed once published
+        unsigned depth = 0;                     // Nesting of enter() calls
+        unsigned retiresSinceAdvance = 0;
+        uint64_t limboEpoch[limboBuckets] = {}; // Epoch the objects in each bucket were retired in
+        std::vector<T*> limbo[limboBuckets];
+    };
+
+    // The calling thread's record for one pool
+    struct CachedRecord {
+        uint64_t poolId;
+        ThreadRecord* record;
+    };
+
+    ThreadRecord* localRecord();
+    ThreadRecord* acquireRecord();
+    void tryAdvance();
+    size_t reclaim(ThreadRecord* record);
+    void freeBucket(std::vector<T*>& bucket);
+
+    // Records of the calling thread, one per pool it has used. Pools are
+    // told apart by a never-reused id rather than their address.
+    static inline thread_local std::vector<CachedRecord> threadRecords;
+    static inline std::atomic<uint64_t> nextPoolId{1};
+
+    ConcurrentMemoryPool<T> pool;           // Slots, reused once reclaimed
+    const uint64_t poolId;                  // Identity for threadRecords
+
+    // Shared mutable state, each on its own cache line
+    alignas(cacheLineSize) std::atomic<uint64_t> globalEpoch;
+    alignas(cacheLineSize) std::atomic<ThreadRecord*> records;  // Every record ever created
+};
+
+#include "EpochMemoryPool.hpp"
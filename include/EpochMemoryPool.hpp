@@ -0,0 +1,207 @@
+#pragma once
+
+template <typename T>
+EpochMemoryPool<T>::EpochMemoryPool(size_t poolSize)
+    : pool(poolSize), poolId(nextPoolId.fetch_add(1, std::memory_order_relaxed)),
+      globalEpoch(0), records(nullptr) {}
+
+template <typename T>
+EpochMemoryPool<T>::~EpochMemoryPool() {
+    ThreadRecord* record = records.load(std::memory_order_acquire);
+    while (record != nullptr) {
+        ThreadRecord* next = record->next;
+        for (auto& bucket : record->limbo) {
+            freeBucket(bucket);
+        }
+        delete record;
+        record = next;
+    }
+}
+
+template <typename T>
+T* EpochMemoryPool<T>::allocate() {
+    // Objects retired in the current epoch need two advances
+    T* ptr = pool.allocate();
+    for (size_t attempt = 1; ptr == nullptr && attempt < limboBuckets; ++attempt) {
+        collect();
+        ptr = pool.allocate();
+    }
+    return ptr;
+}
+
+template <typename T>
+void EpochMemoryPool<T>::deallocate(T* ptr) {
+    pool.deallocate(ptr);
+}
+
+template <typename T>
+template <typename... Args>
+T* EpochMemoryPool<T>::create(Args&&... args) {
+    T* ptr = allocate();
+    if (ptr != nullptr) {
+        try {
+            new (ptr) T(std::forward<Args>(args)...);
+        } catch (...) {
+            pool.deallocate(ptr);
+            throw;
+        }
+    }
+    return ptr;
+}
+
+template <typename T>
+void EpochMemoryPool<T>::destroy(T* ptr) {
+    if (ptr != nullptr) {
+        ptr->~T();
+        pool.deallocate(ptr);
+    }
+}
+
+template <typename T>
+void EpochMemoryPool<T>::retire(T* ptr) {
+    if (ptr == nullptr) {
+        return;
+    }
+    if (!pool.owns(ptr)) {
+        throw std::invalid_argument("Pointer does not belong to this memory pool");
+    }
+
+    ThreadRecord* record = localRecord();
+
+    // The fence orders the caller's unlink before the epoch read, so any
+    // reader that can still reach ptr entered in this epoch or earlier
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    uint64_t epoch = globalEpoch.load(std::memory_order_seq_cst);
+
+    // A bucket stamped with an older epoch of the same residue is at least
+    // three epochs old, so its objects are safe to free now
+    size_t b = epoch % limboBuckets;
+    if (record->limboEpoch[b] != epoch) {
+        freeBucket(record->limbo[b]);
+        record->limboEpoch[b] = epoch;
+    }
+    record->limbo[b].push_back(ptr);
+
+    if (++record->retiresSinceAdvance >= advanceInterval) {
+        record->retiresSinceAdvance = 0;
+        tryAdvance();
+        reclaim(record);
+    }
+}
+
+template <typename T>
+void EpochMemoryPool<T>::enter() {
+    ThreadRecord* record = localRecord();
+    if (record->depth++ == 0) {
+        // Announce the epoch before reading any shared pointer
+        uint64_t epoch = globalEpoch.load(std::memory_order_seq_cst);
+        record->state.store((epoch << 1) | 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+}
+
+template <typename T>
+void EpochMemoryPool<T>::exit() {
+    ThreadRecord* record = localRecord();
+    if (--record->depth == 0) {
+        record->state.store(0, std::memory_order_release);
+    }
+}
+
+template <typename T>
+size_t EpochMemoryPool<T>::collect() {
+    ThreadRecord* record = localRecord();
+    tryAdvance();
+    return reclaim(record);
+}
+
+template <typename T>
+void EpochMemoryPool<T>::detachThread() {
+    for (auto it = threadRecords.begin(); it != threadRecords.end(); ++it) {
+        if (it->poolId == poolId) {
+            ThreadRecord* record = it->record;
+            tryAdvance();
+            reclaim(record);
+            record->retiresSinceAdvance = 0;
+            record->inUse.store(false, std::memory_order_release);
+            threadRecords.erase(it);
+            return;
+        }
+    }
+}
+
+template <typename T>
+typename EpochMemoryPool<T>::ThreadRecord* EpochMemoryPool<T>::localRecord() {
+    // Newest entries first; a thread using one pool hits on the first check
+    for (auto it = threadRecords.rbegin(); it != threadRecords.rend(); ++it) {
+        if (it->poolId == poolId) {
+            return it->record;
+        }
+    }
+    ThreadRecord* record = acquireRecord();
+    threadRecords.push_back({poolId, record});
+    return record;
+}
+
+template <typename T>
+typename EpochMemoryPool<T>::ThreadRecord* EpochMemoryPool<T>::acquireRecord() {
+    // Adopt a detached record, together with whatever it still has in limbo
+    for (ThreadRecord* record = records.load(std::memory_order_acquire); record != nullptr; record = record->next) {
+        bool expected = false;
+        if (!record->inUse.load(std::memory_order_relaxed) &&
+            record->inUse.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+            return record;
+        }
+    }
+
+    ThreadRecord* record = new ThreadRecord();
+    ThreadRecord* head = records.load(std::memory_order_relaxed);
+    do {
+        record->next = head;
+    } while (!records.compare_exchange_weak(head, record, std::memory_order_release, std::memory_order_relaxed));
+    return record;
+}
+
+template <typename T>
+void EpochMemoryPool<T>::tryAdvance() {
+    uint64_t epoch = globalEpoch.load(std::memory_order_seq_cst);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    // Every thread inside a critical section must have seen this epoch
+    for (ThreadRecord* record = records.load(std::memory_order_acquire); record != nullptr; record = record->next) {
+        uint64_t state = record->state.load(std::memory_order_acquire);
+        if ((state & 1) != 0 && (state >> 1) != epoch) {
+            return;
+        }
+    }
+
+    // Losing the race means another thread advanced it already
+    globalEpoch.compare_exchange_strong(epoch, epoch + 1, std::memory_order_seq_cst);
+}
+
+template <typename T>
+size_t EpochMemoryPool<T>::reclaim(ThreadRecord* record) {
+    uint64_t epoch = globalEpoch.load(std::memory_order_acquire);
+    size_t freed = 0;
+    for (size_t b = 0; b < limboBuckets; ++b) {
+        if (record->limboEpoch[b] + 2 <= epoch) {
+            freed += record->limbo[b].size();
+            freeBucket(record->limbo[b]);
+        }
+    }
+    return freed;
+}
+
+template <typename T>
+void EpochMemoryPool<T>::freeBucket(std::vector<T*>& bucket) {
+    if (bucket.empty()) {
+        return;
+    }
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+        for (T* ptr : bucket) {
+            ptr->~T();
+        }
+    }
+    pool.deallocateN(bucket.data(), bucket.size());
+    bucket.clear();
+}
@@ -0,0 +1,93 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <stdexcept>
+#include <unordered_set>
+
+// MemoryPool variant that chains additional fixed-size slabs instead of
+// returning nullptr when exhausted.
+// Every slab is a power-of-two sized block aligned to its own size with a
+// header at its start, so deallocate() finds the owning slab by masking the
+// pointer. Before touching the header it looks the slab address up in a hash
+// set of this pool's slabs: a stray pointer is rejected without reading
+// memory the pool does not own, at the cost of one hash probe per free rather
+// than a magic field in the header. Slabs with free slots are kept on an
+// intrusive list, so allocate() is O(1) and deallocate() O(1) on average.
+template <typename T>
+class GrowableMemoryPool {
+public:
+    // Constructor: slotsPerSlab is the minimum slot count of each slab;
+    // maxSlabs caps growth (0 means unlimited)
+    explicit GrowableMemoryPool(size_t slotsPerSlab, size_t maxSlabs = 0);
+
+    // Destructor: releases every slab
+    ~GrowableMemoryPool();
+
+    GrowableMemoryPool(const GrowableMemoryPool&) = delete;
+    GrowableMemoryPool& operator=(const GrowableMemoryPool&) = delete;
+
+    // Allocate memory for an object of type T, adding a slab if needed;
+    // returns nullptr only when maxSlabs is reached or the system is out of memory
+    T* allocate();
+
+    // Free memory and return it to its slab; throws std::invalid_argument
+    // for a pointer that is not a slot of this pool
+    void deallocate(T* ptr);
+
+    // Check whether a pointer is a slot this pool has handed out; never
+    // reads memory outside the pool's own slabs
+    bool owns(const T* ptr) const;
+
+    // Release fully free slabs back to the system, keeping at most
+    // keepFreeSlabs of them; returns the number of slabs released
+    size_t trim(size_t keepFreeSlabs = 0);
+
+    // Get the number of slots in each slab
+    size_t getSlotsPerSlab() const { return slotsPerSlab; }
+
+    // Get the number of slabs currently held
+    size_t getSlabCount() const { return slabCount; }
+
+    // Get the total pool size across all slabs
+    size_t getPoolSize() const { return slabCount * slotsPerSlab; }
+
+    // Get the number of available slots in the slabs already held
+    size_t getAvailableSlots() const { return getPoolSize() - usedSlots; }
+
+    // Check if no object is allocated
+    bool isEmpty() const { return usedSlots == 0; }
+
+private:
+    struct SlabHeader {
+        SlabHeader* nextSlab;       // Next slab in the list of all slabs
+        SlabHeader* prevPartial;    // Neighbours in the list of slabs with free slots
+        SlabHeader* nextPartial;
+        void* freeList;             // Recycled slots, linked through their first word
+        size_t usedSlots;           // Slots currently allocated from this slab
+        size_t highWater;           // Slots at or above this index were never used
+        bool inPartialList;
+    };
+
+    static constexpr size_t slotAlign = alignof(T) > alignof(void*) ? alignof(T) : alignof(void*);
+    static constexpr size_t objectSize = ((sizeof(T) > sizeof(void*) ? sizeof(T) : sizeof(void*))
+                                          + slotAlign - 1) & ~(slotAlign - 1);
+    static constexpr size_t headerSize = (sizeof(SlabHeader) + slotAlign - 1) & ~(slotAlign - 1);
+
+    SlabHeader* addSlab();
+    void linkPartial(SlabHeader* slab);
+    void unlinkPartial(SlabHeader* slab);
+    char* slotsOf(SlabHeader* slab) const { return reinterpret_cast<char*>(slab) + headerSize; }
+
+    SlabHeader* slabs;          // All slabs
+    std::unordered_set<uintptr_t> slabBases;    // Slab addresses, to vet pointers
+    SlabHeader* partialSlabs;   // Slabs with at least one free slot
+    size_t slabBytes;           // Size and alignment of every slab
+    size_t slotsPerSlab;        // Slots carved from each slab
+    size_t maxSlabs;            // Growth limit (0 = unlimited)
+    size_t slabCount;           // Number of slabs held
+    size_t usedSlots;           // Objects allocated across all slabs
+};
+
+#include "GrowableMemoryPool.hpp"
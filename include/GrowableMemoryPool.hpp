@@ -0,0 +1,172 @@
+#pragma once
+#include <bit>
+
+template <typename T>
+GrowableMemoryPool<T>::GrowableMemoryPool(size_t slotsPerSlab, size_t maxSlabs)
+    : slabs(nullptr), partialSlabs(nullptr), maxSlabs(maxSlabs), slabCount(0), usedSlots(0) {
+
+    if (slotsPerSlab == 0) {
+        throw std::invalid_argument("Slab size must be greater than 0");
+    }
+
+    // Round the slab up to a power of two so it can be aligned to its size,
+    // then use the rounding slack for extra slots
+    slabBytes = std::bit_ceil(headerSize + slotsPerSlab * objectSize);
+    this->slotsPerSlab = (slabBytes - headerSize) / objectSize;
+}
+
+template <typename T>
+GrowableMemoryPool<T>::~GrowableMemoryPool() {
+    while (slabs != nullptr) {
+        SlabHeader* next = slabs->nextSlab;
+        std::free(slabs);
+        slabs = next;
+    }
+}
+
+template <typename T>
+typename GrowableMemoryPool<T>::SlabHeader* GrowableMemoryPool<T>::addSlab() {
+    if (maxSlabs != 0 && slabCount == maxSlabs) {
+        return nullptr;
+    }
+
+    void* memory = std::aligned_alloc(slabBytes, slabBytes);
+    if (memory == nullptr) {
+        return nullptr;
+    }
+
+    // Record the slab first, so a failure leaves the pool unchanged
+    uintptr_t base = reinterpret_cast<uintptr_t>(memory);
+    try {
+        slabBases.insert(base);
+    } catch (const std::bad_alloc&) {
+        std::free(memory);
+        return nullptr;
+    }
+
+    SlabHeader* slab = static_cast<SlabHeader*>(memory);
+    slab->nextSlab = slabs;
+    slab->prevPartial = nullptr;
+    slab->nextPartial = nullptr;
+    slab->freeList = nullptr;
+    slab->usedSlots = 0;
+    slab->highWater = 0;
+    slab->inPartialList = false;
+
+    slabs = slab;
+    slabCount++;
+    linkPartial(slab);
+    return slab;
+}
+
+template <typename T>
+void GrowableMemoryPool<T>::linkPartial(SlabHeader* slab) {
+    slab->prevPartial = nullptr;
+    slab->nextPartial = partialSlabs;
+    if (partialSlabs != nullptr) {
+        partialSlabs->prevPartial = slab;
+    }
+    partialSlabs = slab;
+    slab->inPartialList = true;
+}
+
+template <typename T>
+void GrowableMemoryPool<T>::unlinkPartial(SlabHeader* slab) {
+    if (slab->prevPartial != nullptr) {
+        slab->prevPartial->nextPartial = slab->nextPartial;
+    } else {
+        partialSlabs = slab->nextPartial;
+    }
+    if (slab->nextPartial != nullptr) {
+        slab->nextPartial->prevPartial = slab->prevPartial;
+    }
+    slab->inPartialList = false;
+}
+
+template <typename T>
+T* GrowableMemoryPool<T>::allocate() {
+    SlabHeader* slab = partialSlabs;
+    if (slab == nullptr) {
+        slab = addSlab();
+        if (slab == nullptr) {
+            return nullptr; // Growth limit reached
+        }
+    }
+
+    // Prefer recycled slots, then carve fresh ones
+    void* slot;
+    if (slab->freeList != nullptr) {
+        slot = slab->freeList;
+        slab->freeList = *static_cast<void**>(slot);
+    } else {
+        slot = slotsOf(slab) + slab->highWater * objectSize;
+        slab->highWater++;
+    }
+
+    slab->usedSlots++;
+    usedSlots++;
+    if (slab->usedSlots == slotsPerSlab) {
+        unlinkPartial(slab);
+    }
+    return static_cast<T*>(slot);
+}
+
+template <typename T>
+void GrowableMemoryPool<T>::deallocate(T* ptr) {
+    if (ptr == nullptr) {
+        return;
+    }
+
+    if (!owns(ptr)) {
+        throw std::invalid_argument("Pointer does not belong to this memory pool");
+    }
+    SlabHeader* slab = reinterpret_cast<SlabHeader*>(reinterpret_cast<uintptr_t>(ptr) & ~(uintptr_t{slabBytes} - 1));
+
+    void* slot = static_cast<void*>(ptr);
+    *static_cast<void**>(slot) = slab->freeList;
+    slab->freeList = slot;
+
+    slab->usedSlots--;
+    usedSlots--;
+    if (!slab->inPartialList) {
+        linkPartial(slab);
+    }
+}
+
+template <typename T>
+bool GrowableMemoryPool<T>::owns(const T* ptr) const {
+    // Find the owning slab from the pointer, and make sure it is ours
+    // before reading its header
+    uintptr_t address = reinterpret_cast<uintptr_t>(ptr);
+    uintptr_t base = address & ~(uintptr_t{slabBytes} - 1);
+    uintptr_t firstSlot = base + headerSize;
+    if (slabBases.count(base) == 0 || address < firstSlot || (address - firstSlot) % objectSize != 0) {
+        return false;
+    }
+
+    // Slots at or above the high-water mark, including the slab's tail past
+    // slotsPerSlab, were never handed out
+    const SlabHeader* slab = reinterpret_cast<const SlabHeader*>(base);
+    return (address - firstSlot) / objectSize < slab->highWater;
+}
+
+template <typename T>
+size_t GrowableMemoryPool<T>::trim(size_t keepFreeSlabs) {
+    size_t released = 0;
+    size_t kept = 0;
+    SlabHeader** link = &slabs;
+    while (*link != nullptr) {
+        SlabHeader* slab = *link;
+        if (slab->usedSlots == 0 && kept++ >= keepFreeSlabs) {
+            *link = slab->nextSlab;
+            unlinkPartial(slab);
+            slabBases.erase(reinterpret_cast<uintptr_t>(slab));
+            std::free(slab);
+            slabCount--;
+            released++;
+        } else {
+            link = &slab->nextSlab;
+        }
+    }
+    return released;
+}
@@ -1,26 +1,118 @@
 #pragma once
+#include <bit>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <cstring>
+#include <limits>
+#include <memory>
+#include <new>
+#include <utility>
 #include <stdexcept>
-#include <iostream>
+#include <type_traits>
+#include "PoolTraits.h"
 
-template <typename T>
+#if defined(__SANITIZE_ADDRESS__)
+#define MEMORY_POOL_ASAN 1
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#define MEMORY_POOL_ASAN 1
+#endif
+#endif
+
+#ifdef MEMORY_POOL_ASAN
+#include <sanitizer/asan_interface.h>
+#endif
+
+template <typename T, typename Traits = DefaultPoolTraits>
 class MemoryPool {
 public:
-    // Constructor: allocates memory pool and initializes free offset array
-    explicit MemoryPool(size_t poolSize);
+    using IndexType = typename Traits::IndexType;
+    using Backing = typename Traits::Backing;
+    using Stats = typename Traits::Stats;
+    using OnFailure = typename Traits::OnFailure;
+    using Handle = std::conditional_t<std::is_void_v<typename Traits::Handle>, PoolHandle<>, typename Traits::Handle>;
+
+    // Constructor: reserves memory for the pool; slots are handed out
+    // sequentially on first use, so no per-slot initialization is done
+    explicit MemoryPool(size_t poolSize, const Backing& backing = Backing());
     
     // Destructor: deallocates the memory pool
     ~MemoryPool();
+
+    MemoryPool(const MemoryPool&) = delete;
+    MemoryPool& operator=(const MemoryPool&) = delete;
     
-    // Allocate memory for an object of type T
+    // Allocate memory for an object of type T; when the pool is full the
+    // result comes from Traits::OnFailure (nullptr by default)
     T* allocate();
     
-    // Free memory and return it to the pool
+    // Free memory and return it to the pool; nullptr is ignored and foreign
+    // pointers go to Traits::OnFailure (std::invalid_argument by default)
     void deallocate(T* ptr);
 
+    // Allocate and construct an object in place; returns nullptr when the
+    // pool is full. If the constructor throws, the slot is returned.
+    template <typename... Args>
+    T* create(Args&&... args);
+
+    // Destroy an object made by create() and return its slot
+    void destroy(T* ptr);
+
+    // Allocate n objects at once into out[0..n); all or nothing, returns
+    // false without allocating when fewer than n slots are available. The
+    // result already reports a shortfall, so OnFailure is not consulted and
+    // no policy makes this throw; fall back per object with allocate().
+    bool allocateN(T** out, size_t n);
+
+    // Return n objects at once. nullptr entries are skipped and pointers
+    // from outside the pool go to Traits::OnFailure, like deallocate(),
+    // before any slot is freed; with the default policy a foreign pointer
+    // throws std::invalid_argument and nothing is freed.
+    void deallocateN(T* const* ptrs, size_t n);
+
+    // Allocate n adjacent never-used slots as one run, or nullptr when the
+    // untouched tail of the pool is too short; like allocateN it never
+    // consults OnFailure. Slots are freed individually.
+    T* allocateContiguous(size_t n);
+
+    // Call f(T*) for every allocated slot in ascending address order. Bitmap
+    // and hardened pools already track live slots; other modes build a
+    // temporary bitmap from the free list first.
+    template <typename F>
+    void forEachLive(F&& f);
+
+    // Return every slot to the pool at once without running destructors.
+    // O(1) for plain offset-array and intrusive pools. Bitmap and hardened
+    // pools clear their bitmaps and handle pools bump every generation
+    // below the high-water mark, which is O(high-water mark).
+    void releaseAll();
+
+    // Destroy every live object, then release all slots. Only valid when
+    // every allocated slot holds a constructed T; free for trivially
+    // destructible types.
+    void reset();
+
+    // Generational handles (pools whose Traits::Handle is not void).
+    // allocateHandle() returns a null handle when the pool is full.
+    Handle allocateHandle();
+
+    // Get the object a handle refers to, or nullptr if its slot has been
+    // freed since the handle was made. O(1): one generation compare.
+    T* resolve(Handle handle) const;
+
+    // Make a handle for an object allocated from this pool
+    Handle handleOf(const T* ptr) const;
+
+    // Free the slot a handle refers to; stale handles are reported to
+    // OnFailure::onCorruption as a double free
+    void deallocate(Handle handle);
     
+    // Check whether a pointer lies inside this pool's slab
+    bool owns(const T* ptr) const {
+        return reinterpret_cast<uintptr_t>(ptr) - reinterpret_cast<uintptr_t>(memoryPool) < poolSize * objectSize;
+    }
+
     // Get the total pool size
     size_t getPoolSize() const { return poolSize; }
     
@@ -33,19 +125,87 @@ public:
     // Check if pool is empty
     bool isEmpty() const { return availableSlots == poolSize; }
 
+    // Get a snapshot of the pool's counters. Without a statistics policy
+    // only the size and occupancy fields are filled in.
+    PoolStatsSnapshot getStats() const;
+
+    // Label this pool in statistics snapshots; the string must outlive the pool
+    void setName(const char* name) { stats.setName(name); }
+
 private:
+    static constexpr bool intrusive = Traits::freeList == FreeListMode::Intrusive;
+    static constexpr bool bitmap = Traits::freeList == FreeListMode::Bitmap;
+    static constexpr bool offsetArray = Traits::freeList == FreeListMode::OffsetArray;
+    static constexpr bool handles = !std::is_void_v<typename Traits::Handle>;
+    using Generation = typename Handle::StorageType;
+    static constexpr IndexType nullIndex = std::numeric_limits<IndexType>::max();
+
+    // Cold paths, kept out of line so the fast paths stay small
+    [[gnu::cold, gnu::noinline]] T* allocateExhausted();
+    [[gnu::cold, gnu::noinline]] void deallocateForeign(T* ptr);
+
+    // Hardened-mode bookkeeping; findings are reported through OnFailure
+    void hardenAllocate(size_t offset, bool recycled);
+    bool hardenDeallocate(T* ptr, size_t offset, bool& overflowed);
+    [[gnu::cold, gnu::noinline]] void reportCorruption(PoolFailure failure, void* ptr);
+    static void poisonRegion(const void* region, size_t bytes);
+    static void unpoisonRegion(const void* region, size_t bytes);
+
+    // Read/write the free-list link stored in a free slot (intrusive mode)
+    IndexType loadLink(size_t offset) const;
+    void storeLink(size_t offset, IndexType next);
+
+    // Take the lowest recycled slot / mark a slot recycled (bitmap mode)
+    size_t popLowestFree();
+    void pushFree(size_t offset);
+
+    // Invalidate outstanding handles to a slot (handle mode)
+    void bumpGeneration(size_t offset);
+
+    static_assert((Traits::alignment & (Traits::alignment - 1)) == 0, "Pool alignment must be a power of two");
+    static_assert(Traits::alignment == 0 || Traits::alignment >= alignof(T), "Pool alignment is weaker than alignof(T)");
+
+    static constexpr bool hardened = Traits::hardened;
+
+    // Size of each slot: intrusive slots are padded to hold a link, hardened
+    // slots are followed by a guard canary, and the stride is rounded up to
+    // the configured alignment
+    static constexpr size_t naturalAlign = intrusive && alignof(IndexType) > alignof(T) ? alignof(IndexType) : alignof(T);
+    static constexpr size_t slotAlign = Traits::alignment > naturalAlign ? Traits::alignment : naturalAlign;
+    static constexpr size_t payloadBytes = intrusive && sizeof(IndexType) > sizeof(T) ? sizeof(IndexType) : sizeof(T);
+    static constexpr size_t canaryOffset = (payloadBytes + alignof(uint64_t) - 1) & ~(alignof(uint64_t) - 1);
+    static constexpr size_t slotBytes = hardened ? canaryOffset + sizeof(uint64_t) : payloadBytes;
+    static constexpr size_t objectSize = (slotBytes + slotAlign - 1) & ~(slotAlign - 1);
+
+    // Hardened-mode patterns: freed bytes are filled with poisonByte, and a
+    // slot's canary is canaryValue mixed with the slot address
+    static constexpr unsigned char poisonByte = 0xDD;
+    static constexpr uint64_t canaryValue = 0xC0FFEE0DDBA11ADEull;
+    static constexpr size_t linkBytes = intrusive ? sizeof(IndexType) : 0;
+
+    // Bitmap mode: one bit per slot, plus one summary bit per bitmap word
+    // that has any bit set, so the lowest free slot is two countr_zero away
+    static constexpr size_t bitmapWords(size_t slots) { return (slots + 63) / 64; }
+    static constexpr size_t freeBitsWords(size_t slots) { return bitmapWords(slots) + bitmapWords(bitmapWords(slots)); }
+
+    // Cache-line aligned pools keep their counters off the line holding the
+    // read-mostly fields and off any neighbouring object's line
+    static constexpr size_t controlAlign = slotAlign >= cacheLineSize ? cacheLineSize : alignof(size_t);
+
+    Backing backing;            // Source of raw memory
     char* memoryPool;           // Raw memory pool
-    size_t* freeOffsets;        // Array of free offsets
+    IndexType* freeOffsets;     // Stack of recycled offsets (offset-array mode only)
+    uint64_t* freeBits;         // Recycled-slot bitmap followed by its summary (bitmap mode only)
     size_t poolSize;            // Total number of objects in pool
-    size_t availableSlots;      // Number of available slots
-    size_t nextFreeIndex;       // Index of next free slot in freeOffsets array
-    
-    // Size of each object (aligned)
-    static constexpr size_t objectSize = sizeof(T);
-    
+    alignas(controlAlign) size_t availableSlots;    // Number of available slots
+    size_t nextFreeIndex;       // Number of recycled slots (freeOffsets stack depth in offset-array mode)
+    size_t highWater;           // Slots at or above this index were never used
+    IndexType freeListHead;     // First recycled slot (intrusive mode only)
+    size_t summaryHint;         // No summary word below this has a bit set (bitmap mode only)
+    uint64_t* allocatedBits;    // One bit per allocated slot (hardened mode only)
+    Generation* generations;    // Generation of each slot, less one (handle mode only)
+    [[no_unique_address]] Stats stats;  // Counters, empty when statistics are disabled
+
 };
 
 #include "MemoryPool.hpp"
-
-
-
@@ -1,64 +1,584 @@
-template <typename T>
-MemoryPool<T>::MemoryPool(size_t poolSize) 
-    : poolSize(poolSize), availableSlots(poolSize), nextFreeIndex(0) {
+template <typename T, typename Traits>
+MemoryPool<T, Traits>::MemoryPool(size_t poolSize, const Backing& backing) 
+    : backing(backing), freeOffsets(nullptr), freeBits(nullptr), poolSize(poolSize), availableSlots(poolSize),
+      nextFreeIndex(0), highWater(0), freeListHead(nullIndex), summaryHint(0), allocatedBits(nullptr),
+      generations(nullptr) {
     
     if (poolSize == 0) {
         throw std::invalid_argument("Pool size must be greater than 0");
     }
+    if (poolSize - 1 >= static_cast<size_t>(nullIndex)) {
+        throw std::invalid_argument("Pool size does not fit the pool's index type");
+    }
+    if (handles && poolSize > Handle::maxSlots) {
+        throw std::invalid_argument("Pool size does not fit the pool's handle type");
+    }
+    
+    // Reserve raw memory pool
+    memoryPool = static_cast<char*>(this->backing.allocate(poolSize * objectSize, slotAlign));
+    
+    // Reserve the recycled offsets stack; it only fills as slots are freed
+    if constexpr (offsetArray) {
+        freeOffsets = static_cast<IndexType*>(this->backing.allocate(poolSize * sizeof(IndexType), alignof(IndexType)));
+    }
+    
+    // Recycled-slot bitmap; one bit per slot, so clearing it up front is cheap
+    if constexpr (bitmap) {
+        freeBits = static_cast<uint64_t*>(this->backing.allocate(freeBitsWords(poolSize) * sizeof(uint64_t), alignof(uint64_t)));
+    }
+    
+    // Allocation bitmap for double-free detection
+    const size_t bitmapBytes = (poolSize + 63) / 64 * sizeof(uint64_t);
+    if constexpr (hardened) {
+        allocatedBits = static_cast<uint64_t*>(this->backing.allocate(bitmapBytes, alignof(uint64_t)));
+    }
     
-    // Allocate raw memory pool
-    memoryPool =  static_cast<char*>(std::malloc(poolSize * objectSize));
+    // Per-slot generations for handle validation
+    if constexpr (handles) {
+        generations = static_cast<Generation*>(this->backing.allocate(poolSize * sizeof(Generation), alignof(Generation)));
+    }
     
-    // Allocate free offsets array
-    freeOffsets = static_cast<size_t*>(std::malloc(poolSize * sizeof(size_t)));
+    if (memoryPool == nullptr || (offsetArray && freeOffsets == nullptr) || (bitmap && freeBits == nullptr) ||
+        (hardened && allocatedBits == nullptr) || (handles && generations == nullptr)) {
+        this->backing.release(memoryPool, poolSize * objectSize);
+        this->backing.release(freeOffsets, poolSize * sizeof(IndexType));
+        this->backing.release(freeBits, freeBitsWords(poolSize) * sizeof(uint64_t));
+        this->backing.release(allocatedBits, bitmapBytes);
+        this->backing.release(generations, poolSize * sizeof(Generation));
+        throw std::bad_alloc();
+    }
     
-    // Initialize free offsets array with sequential offsets
-    for (size_t i = 0; i < poolSize; ++i) {
-        freeOffsets[i] = i;
+    if constexpr (handles) {
+        std::memset(generations, 0, poolSize * sizeof(Generation));
     }
+    
+    if constexpr (bitmap) {
+        std::memset(freeBits, 0, freeBitsWords(poolSize) * sizeof(uint64_t));
+    }
+    
+    if constexpr (hardened) {
+        std::memset(allocatedBits, 0, bitmapBytes);
+        poisonRegion(memoryPool, poolSize * objectSize);
+    }
+    
+    stats.attach(poolSize, objectSize);
 }
 
-template <typename T>
-MemoryPool<T>::~MemoryPool() {
-    std::free(memoryPool);
-    std::free(freeOffsets);
+template <typename T, typename Traits>
+MemoryPool<T, Traits>::~MemoryPool() {
+    if constexpr (hardened) {
+        unpoisonRegion(memoryPool, poolSize * objectSize);
+        backing.release(allocatedBits, (poolSize + 63) / 64 * sizeof(uint64_t));
+    }
+    backing.release(memoryPool, poolSize * objectSize);
+    if constexpr (offsetArray) {
+        backing.release(freeOffsets, poolSize * sizeof(IndexType));
+    }
+    if constexpr (bitmap) {
+        backing.release(freeBits, freeBitsWords(poolSize) * sizeof(uint64_t));
+    }
+    if constexpr (handles) {
+        backing.release(generations, poolSize * sizeof(Generation));
+    }
+}
+
+template <typename T, typename Traits>
+typename MemoryPool<T, Traits>::IndexType MemoryPool<T, Traits>::loadLink(size_t offset) const {
+    IndexType next;
+    if constexpr (hardened) {
+        unpoisonRegion(memoryPool + offset * objectSize, sizeof(IndexType));
+    }
+    std::memcpy(&next, memoryPool + offset * objectSize, sizeof(IndexType));
+    return next;
+}
+
+template <typename T, typename Traits>
+void MemoryPool<T, Traits>::poisonRegion([[maybe_unused]] const void* region, [[maybe_unused]] size_t bytes) {
+#ifdef MEMORY_POOL_ASAN
+    if constexpr (hardened) {
+        ASAN_POISON_MEMORY_REGION(region, bytes);
+    }
+#endif
+}
+
+template <typename T, typename Traits>
+void MemoryPool<T, Traits>::unpoisonRegion([[maybe_unused]] const void* region, [[maybe_unused]] size_t bytes) {
+#ifdef MEMORY_POOL_ASAN
+    if constexpr (hardened) {
+        ASAN_UNPOISON_MEMORY_REGION(region, bytes);
+    }
+#endif
+}
+
+template <typename T, typename Traits>
+void MemoryPool<T, Traits>::reportCorruption(PoolFailure failure, void* ptr) {
+    OnFailure::onCorruption(failure, ptr);
+}
+
+template <typename T, typename Traits>
+void MemoryPool<T, Traits>::hardenAllocate(size_t offset, bool recycled) {
+    unsigned char* slot = reinterpret_cast<unsigned char*>(memoryPool + offset * objectSize);
+    unpoisonRegion(slot, payloadBytes);
+    allocatedBits[offset / 64] |= uint64_t{1} << (offset % 64);
+    
+    // The canary stays ASan-poisoned, so overflows fault at once under ASan
+    uint64_t canary = canaryValue ^ reinterpret_cast<uintptr_t>(slot);
+    unpoisonRegion(slot + canaryOffset, sizeof(uint64_t));
+    std::memcpy(slot + canaryOffset, &canary, sizeof(uint64_t));
+    poisonRegion(slot + canaryOffset, sizeof(uint64_t));
+    
+    // A recycled slot must still hold the poison written when it was freed;
+    // checked last so the pool is consistent if the report throws
+    if (recycled) {
+        for (size_t i = linkBytes; i < payloadBytes; ++i) {
+            if (slot[i] != poisonByte) {
+                reportCorruption(PoolFailure::UseAfterFree, slot);
+                break;
+            }
+        }
+    }
 }
 
-template <typename T>
-T* MemoryPool<T>::allocate() {
-    if (availableSlots == 0) {
-        std::cerr<<"Pool is full, change the size of the pool"<<std::endl;
-        return nullptr; // Pool is full
+template <typename T, typename Traits>
+bool MemoryPool<T, Traits>::hardenDeallocate(T* ptr, size_t offset, bool& overflowed) {
+    unsigned char* slot = reinterpret_cast<unsigned char*>(ptr);
+    if (static_cast<size_t>(slot - reinterpret_cast<unsigned char*>(memoryPool)) % objectSize != 0) {
+        reportCorruption(PoolFailure::MisalignedPointer, ptr);
+        return false;
+    }
+    
+    uint64_t& word = allocatedBits[offset / 64];
+    const uint64_t bit = uint64_t{1} << (offset % 64);
+    if ((word & bit) == 0) {
+        reportCorruption(PoolFailure::DoubleFree, ptr);
+        return false;
     }
+    word &= ~bit;
     
-    // Get the next free offset
-    size_t offset = freeOffsets[nextFreeIndex];
+    uint64_t canary;
+    unpoisonRegion(slot + canaryOffset, sizeof(uint64_t));
+    std::memcpy(&canary, slot + canaryOffset, sizeof(uint64_t));
+    poisonRegion(slot + canaryOffset, sizeof(uint64_t));
+    overflowed = canary != (canaryValue ^ reinterpret_cast<uintptr_t>(slot));
+    
+    std::memset(slot + linkBytes, poisonByte, payloadBytes - linkBytes);
+    return true;
+}
+
+template <typename T, typename Traits>
+void MemoryPool<T, Traits>::storeLink(size_t offset, IndexType next) {
+    std::memcpy(memoryPool + offset * objectSize, &next, sizeof(IndexType));
+}
+
+template <typename T, typename Traits>
+size_t MemoryPool<T, Traits>::popLowestFree() {
+    uint64_t* summary = freeBits + bitmapWords(poolSize);
+    while (summary[summaryHint] == 0) {
+        summaryHint++;
+    }
     
-    // Move to next free slot
+    size_t word = summaryHint * 64 + static_cast<size_t>(std::countr_zero(summary[summaryHint]));
+    uint64_t bits = freeBits[word];
+    size_t offset = word * 64 + static_cast<size_t>(std::countr_zero(bits));
+    bits &= bits - 1;
+    freeBits[word] = bits;
+    if (bits == 0) {
+        summary[summaryHint] &= ~(uint64_t{1} << (word % 64));
+    }
+    nextFreeIndex--;
+    return offset;
+}
+
+template <typename T, typename Traits>
+void MemoryPool<T, Traits>::pushFree(size_t offset) {
+    uint64_t* summary = freeBits + bitmapWords(poolSize);
+    size_t word = offset / 64;
+    freeBits[word] |= uint64_t{1} << (offset % 64);
+    summary[word / 64] |= uint64_t{1} << (word % 64);
+    if (word / 64 < summaryHint) {
+        summaryHint = word / 64;
+    }
     nextFreeIndex++;
+}
+
+template <typename T, typename Traits>
+void MemoryPool<T, Traits>::bumpGeneration(size_t offset) {
+    // Stored generations run from 0 to maxGeneration - 1; handles add one
+    Generation next = static_cast<Generation>(generations[offset] + 1);
+    generations[offset] = next == Handle::maxGeneration ? Generation{0} : next;
+}
+
+template <typename T, typename Traits>
+T* MemoryPool<T, Traits>::allocateExhausted() {
+    stats.recordFailure();
+    return static_cast<T*>(OnFailure::onExhausted(sizeof(T), alignof(T)));
+}
+
+template <typename T, typename Traits>
+void MemoryPool<T, Traits>::deallocateForeign(T* ptr) {
+    OnFailure::onForeignPointer(ptr, sizeof(T), alignof(T));
+}
+
+template <typename T, typename Traits>
+T* MemoryPool<T, Traits>::allocate() {
+    uint64_t sample = stats.beginSample();
+    if (availableSlots == 0) [[unlikely]] {
+        return allocateExhausted(); // Pool is full
+    }
+    
+    // Reuse the most recently freed slot (the lowest one in bitmap mode),
+    // otherwise take a never-used one
+    size_t offset;
+    [[maybe_unused]] bool recycled = true;
+    if constexpr (bitmap) {
+        if (nextFreeIndex != 0) {
+            offset = popLowestFree();
+        } else {
+            offset = highWater++;
+            recycled = false;
+        }
+    } else if constexpr (intrusive) {
+        if (freeListHead != nullIndex) {
+            offset = freeListHead;
+            freeListHead = loadLink(offset);
+        } else {
+            offset = highWater++;
+            recycled = false;
+        }
+    } else {
+        if (nextFreeIndex != 0) {
+            nextFreeIndex--;
+            offset = freeOffsets[nextFreeIndex];
+        } else {
+            offset = highWater++;
+            recycled = false;
+        }
+    }
     availableSlots--;
+    if constexpr (hardened) {
+        hardenAllocate(offset, recycled);
+    }
+    stats.recordAllocate(1, poolSize - availableSlots);
+    stats.endSample(sample);
     
     // Return pointer to allocated memory
-    return reinterpret_cast<T*>(memoryPool + offset);
+    return reinterpret_cast<T*>(memoryPool + offset * objectSize);
 }
 
-template <typename T>
-void MemoryPool<T>::deallocate(T* ptr) {
-    if (ptr == nullptr) {
-        std::cerr<<"Pointer is nullptr, cannot deallocate"<<std::endl;
+template <typename T, typename Traits>
+void MemoryPool<T, Traits>::deallocate(T* ptr) {
+    if (ptr == nullptr) [[unlikely]] {
         return;
     }
     
-    // Calculate offset of the pointer
-    size_t offset = (static_cast<char*>(static_cast<void*>(ptr)) - memoryPool) / objectSize;
-    
     // Validate that the pointer belongs to this pool
-    if (offset >= poolSize) {
-        throw std::invalid_argument("Pointer does not belong to this memory pool");
+    if (!owns(ptr)) [[unlikely]] {
+        deallocateForeign(ptr);
+        return;
     }
     
-    nextFreeIndex--;
+    // Calculate offset of the pointer
+    size_t offset = static_cast<size_t>(reinterpret_cast<char*>(ptr) - memoryPool) / objectSize;
+    [[maybe_unused]] bool overflowed = false;
+    if constexpr (hardened) {
+        if (!hardenDeallocate(ptr, offset, overflowed)) {
+            return;
+        }
+    }
+    
+    if constexpr (handles) {
+        bumpGeneration(offset);
+    }
+    if constexpr (bitmap) {
+        pushFree(offset);
+    } else if constexpr (intrusive) {
+        storeLink(offset, freeListHead);
+        freeListHead = static_cast<IndexType>(offset);
+    } else {
+        freeOffsets[nextFreeIndex] = static_cast<IndexType>(offset);
+        nextFreeIndex++;
+    }
     availableSlots++;
-    freeOffsets[nextFreeIndex] = offset;
+    if constexpr (hardened) {
+        poisonRegion(ptr, payloadBytes);
+        if (overflowed) {
+            reportCorruption(PoolFailure::BufferOverflow, ptr);
+        }
+    }
+    stats.recordDeallocate(1);
+}
+
+template <typename T, typename Traits>
+template <typename... Args>
+T* MemoryPool<T, Traits>::create(Args&&... args) {
+    T* slot = allocate();
+    if (slot == nullptr) {
+        return nullptr;
+    }
+    
+    try {
+        return new (slot) T(std::forward<Args>(args)...);
+    } catch (...) {
+        deallocate(slot);
+        throw;
+    }
+}
+
+template <typename T, typename Traits>
+void MemoryPool<T, Traits>::destroy(T* ptr) {
+    if (ptr == nullptr) {
+        return;
+    }
+    
+    ptr->~T();
+    deallocate(ptr);
 }
 
+template <typename T, typename Traits>
+bool MemoryPool<T, Traits>::allocateN(T** out, size_t n) {
+    if (n > availableSlots) {
+        stats.recordFailure();
+        return false;
+    }
+    
+    // Hardened pools check every slot individually
+    if constexpr (hardened) {
+        for (size_t i = 0; i < n; ++i) {
+            out[i] = allocate();
+        }
+        return true;
+    }
+    
+    size_t produced = 0;
+    if constexpr (bitmap) {
+        while (produced < n && nextFreeIndex != 0) {
+            out[produced++] = reinterpret_cast<T*>(memoryPool + popLowestFree() * objectSize);
+        }
+    } else if constexpr (intrusive) {
+        while (produced < n && freeListHead != nullIndex) {
+            size_t offset = freeListHead;
+            freeListHead = loadLink(offset);
+            out[produced++] = reinterpret_cast<T*>(memoryPool + offset * objectSize);
+        }
+    } else {
+        // Take the top of the recycled stack in one step, in pop order
+        size_t recycled = n < nextFreeIndex ? n : nextFreeIndex;
+        for (size_t i = 0; i < recycled; ++i) {
+            out[i] = reinterpret_cast<T*>(memoryPool + static_cast<size_t>(freeOffsets[nextFreeIndex - 1 - i]) * objectSize);
+        }
+        nextFreeIndex -= recycled;
+        produced = recycled;
+    }
+    
+    // Fill the rest from never-used slots
+    char* fresh = memoryPool + highWater * objectSize;
+    for (size_t i = produced; i < n; ++i) {
+        out[i] = reinterpret_cast<T*>(fresh + (i - produced) * objectSize);
+    }
+    highWater += n - produced;
+    availableSlots -= n;
+    stats.recordAllocate(n, poolSize - availableSlots);
+    return true;
+}
+
+template <typename T, typename Traits>
+void MemoryPool<T, Traits>::deallocateN(T* const* ptrs, size_t n) {
+    // Foreign pointers go to the failure policy before anything is freed,
+    // so a policy that throws or aborts leaves the pool untouched
+    size_t owned = 0;
+    for (size_t i = 0; i < n; ++i) {
+        if (owns(ptrs[i])) {
+            owned++;
+        } else if (ptrs[i] != nullptr) [[unlikely]] {
+            deallocateForeign(ptrs[i]);
+        }
+    }
+    if (owned > poolSize - availableSlots) [[unlikely]] {
+        reportCorruption(PoolFailure::DoubleFree, nullptr);
+        return;
+    }
+    
+    // Hardened pools check every slot individually
+    if constexpr (hardened) {
+        for (size_t i = 0; i < n; ++i) {
+            if (owns(ptrs[i])) {
+                deallocate(ptrs[i]);
+            }
+        }
+        return;
+    }
+    
+    const uintptr_t base = reinterpret_cast<uintptr_t>(memoryPool);
+    for (size_t i = 0; i < n; ++i) {
+        if (!owns(ptrs[i])) [[unlikely]] {
+            continue;
+        }
+        size_t offset = (reinterpret_cast<uintptr_t>(ptrs[i]) - base) / objectSize;
+        if constexpr (handles) {
+            bumpGeneration(offset);
+        }
+        if constexpr (bitmap) {
+            pushFree(offset);
+        } else if constexpr (intrusive) {
+            storeLink(offset, freeListHead);
+            freeListHead = static_cast<IndexType>(offset);
+        } else {
+            freeOffsets[nextFreeIndex++] = static_cast<IndexType>(offset);
+        }
+    }
+    availableSlots += owned;
+    stats.recordDeallocate(owned);
+}
+
+template <typename T, typename Traits>
+T* MemoryPool<T, Traits>::allocateContiguous(size_t n) {
+    if (n == 0 || n > poolSize - highWater) {
+        stats.recordFailure();
+        return nullptr;
+    }
+    
+    T* run = reinterpret_cast<T*>(memoryPool + highWater * objectSize);
+    if constexpr (hardened) {
+        for (size_t i = 0; i < n; ++i) {
+            hardenAllocate(highWater + i, false);
+        }
+    }
+    highWater += n;
+    availableSlots -= n;
+    stats.recordAllocate(n, poolSize - availableSlots);
+    return run;
+}
+
+template <typename T, typename Traits>
+template <typename F>
+void MemoryPool<T, Traits>::forEachLive(F&& f) {
+    const size_t words = bitmapWords(highWater);
+    
+    // Live slots are those below the high-water mark that are not free
+    const uint64_t* freeMask = freeBits;
+    std::unique_ptr<uint64_t[]> scratch;
+    if constexpr (!bitmap && !hardened) {
+        scratch = std::make_unique<uint64_t[]>(words);
+        if constexpr (intrusive) {
+            for (size_t offset = freeListHead; offset != nullIndex; offset = loadLink(offset)) {
+                scratch[offset / 64] |= uint64_t{1} << (offset % 64);
+            }
+        } else {
+            for (size_t i = 0; i < nextFreeIndex; ++i) {
+                scratch[freeOffsets[i] / 64] |= uint64_t{1} << (freeOffsets[i] % 64);
+            }
+        }
+        freeMask = scratch.get();
+    }
+    
+    for (size_t word = 0; word < words; ++word) {
+        uint64_t live;
+        if constexpr (hardened && !bitmap) {
+            live = allocatedBits[word];
+        } else {
+            live = ~freeMask[word];
+        }
+        if (highWater - word * 64 < 64) {
+            live &= (uint64_t{1} << (highWater - word * 64)) - 1;
+        }
+        while (live != 0) {
+            size_t offset = word * 64 + static_cast<size_t>(std::countr_zero(live));
+            live &= live - 1;
+            f(reinterpret_cast<T*>(memoryPool + offset * objectSize));
+        }
+    }
+}
+
+template <typename T, typename Traits>
+void MemoryPool<T, Traits>::releaseAll() {
+    const size_t inUse = poolSize - availableSlots;
+    
+    // Only words below the high-water mark can have bits set
+    if constexpr (bitmap) {
+        std::memset(freeBits, 0, bitmapWords(highWater) * sizeof(uint64_t));
+        std::memset(freeBits + bitmapWords(poolSize), 0, bitmapWords(bitmapWords(highWater)) * sizeof(uint64_t));
+        summaryHint = 0;
+    }
+    if constexpr (hardened) {
+        std::memset(allocatedBits, 0, bitmapWords(highWater) * sizeof(uint64_t));
+        poisonRegion(memoryPool, highWater * objectSize);
+    }
+    
+    // Slots below the high-water mark may have outstanding handles
+    if constexpr (handles) {
+        for (size_t offset = 0; offset < highWater; ++offset) {
+            bumpGeneration(offset);
+        }
+    }
+    
+    // Every slot becomes never-used again
+    availableSlots = poolSize;
+    nextFreeIndex = 0;
+    highWater = 0;
+    freeListHead = nullIndex;
+    stats.recordDeallocate(inUse);
+}
+
+template <typename T, typename Traits>
+void MemoryPool<T, Traits>::reset() {
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+        forEachLive([](T* obj) { obj->~T(); });
+    }
+    releaseAll();
+}
+
+template <typename T, typename Traits>
+typename MemoryPool<T, Traits>::Handle MemoryPool<T, Traits>::allocateHandle() {
+    static_assert(handles, "allocateHandle() needs Traits::Handle");
+    T* ptr = allocate();
+    if (!owns(ptr)) {
+        // Memory from a fallback failure policy has no slot to refer to
+        if (ptr != nullptr) {
+            deallocateForeign(ptr);
+        }
+        return Handle();
+    }
+    return handleOf(ptr);
+}
+
+template <typename T, typename Traits>
+T* MemoryPool<T, Traits>::resolve(Handle handle) const {
+    static_assert(handles, "resolve() needs Traits::Handle");
+    const size_t offset = handle.index();
+    if (offset >= highWater || static_cast<Generation>(generations[offset] + 1) != handle.generation()) {
+        return nullptr;
+    }
+    return reinterpret_cast<T*>(memoryPool + offset * objectSize);
+}
+
+template <typename T, typename Traits>
+typename MemoryPool<T, Traits>::Handle MemoryPool<T, Traits>::handleOf(const T* ptr) const {
+    static_assert(handles, "handleOf() needs Traits::Handle");
+    const size_t offset = static_cast<size_t>(reinterpret_cast<const char*>(ptr) - memoryPool) / objectSize;
+    return Handle::make(offset, static_cast<Generation>(generations[offset] + 1));
+}
+
+template <typename T, typename Traits>
+void MemoryPool<T, Traits>::deallocate(Handle handle) {
+    T* ptr = resolve(handle);
+    if (ptr == nullptr) {
+        if (handle) {
+            reportCorruption(PoolFailure::DoubleFree, handle.index() < poolSize ? memoryPool + handle.index() * objectSize : nullptr);
+        }
+        return;
+    }
+    deallocate(ptr);
+}
+
+template <typename T, typename Traits>
+PoolStatsSnapshot MemoryPool<T, Traits>::getStats() const {
+    if constexpr (Stats::enabled) {
+        return stats.snapshot();
+    } else {
+        PoolStatsSnapshot result;
+        result.objectSize = objectSize;
+        result.poolSize = poolSize;
+        result.inUse = poolSize - availableSlots;
+        return result;
+    }
+}
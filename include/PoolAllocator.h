@@ -0,0 +1,141 @@
+#pragma once
+#include <cstddef>
+#include <memory_resource>
+#include <new>
+#include <tuple>
+#include "GrowableMemoryPool.h"
+#include "PoolBlock.h"
+
+// std::pmr::memory_resource that serves each request from the smallest
+// GrowableMemoryPool whose block fits it. Requests larger than the biggest
+// block or aligned beyond max_align_t go to the upstream resource, and so
+// does freeing a block none of the pools handed out.
+// Not thread-safe, like the pools it owns.
+template <size_t... BlockSizes>
+class PoolMemoryResource : public std::pmr::memory_resource {
+public:
+    static_assert(sizeof...(BlockSizes) > 0, "At least one block size is required");
+
+    explicit PoolMemoryResource(size_t slotsPerSlab = 1024,
+                                std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+        : pools(((void)BlockSizes, slotsPerSlab)...), upstream(upstream) {}
+
+    PoolMemoryResource(const PoolMemoryResource&) = delete;
+    PoolMemoryResource& operator=(const PoolMemoryResource&) = delete;
+
+    // Non-virtual fast paths, used directly by PoolAllocator
+    void* allocateBlock(size_t bytes, size_t alignment) {
+        if (alignment > alignof(std::max_align_t)) {
+            return upstream->allocate(bytes, alignment);
+        }
+        return allocateFrom<0>(bytes);
+    }
+
+    void deallocateBlock(void* ptr, size_t bytes, size_t alignment) {
+        if (alignment > alignof(std::max_align_t)) {
+            upstream->deallocate(ptr, bytes, alignment);
+            return;
+        }
+        deallocateFrom<0>(ptr, bytes);
+    }
+
+    // Release fully free slabs of every size class
+    size_t trim() {
+        return std::apply([](auto&... pool) { return (pool.trim() + ...); }, pools);
+    }
+
+    std::pmr::memory_resource* getUpstream() const { return upstream; }
+
+protected:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        return allocateBlock(bytes, alignment);
+    }
+
+    void do_deallocate(void* ptr, size_t bytes, size_t alignment) override {
+        deallocateBlock(ptr, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+private:
+    static constexpr size_t blockSizes[] = {BlockSizes...};
+
+    template <size_t I>
+    void* allocateFrom(size_t bytes) {
+        if constexpr (I == sizeof...(BlockSizes)) {
+            return upstream->allocate(bytes, alignof(std::max_align_t));
+        } else {
+            if (bytes <= blockSizes[I]) {
+                void* block = std::get<I>(pools).allocate();
+                if (block == nullptr) {
+                    throw std::bad_alloc();
+                }
+                return block;
+            }
+            return allocateFrom<I + 1>(bytes);
+        }
+    }
+
+    template <size_t I>
+    void deallocateFrom(void* ptr, size_t bytes) {
+        if constexpr (I == sizeof...(BlockSizes)) {
+            upstream->deallocate(ptr, bytes, alignof(std::max_align_t));
+        } else {
+            if (bytes <= blockSizes[I]) {
+                // Containers free from destructors, so nothing may throw here;
+                // a block no pool handed out can only be the upstream's
+                auto* block = static_cast<PoolBlock<blockSizes[I]>*>(ptr);
+                if (std::get<I>(pools).owns(block)) {
+                    std::get<I>(pools).deallocate(block);
+                } else {
+                    upstream->deallocate(ptr, bytes, alignof(std::max_align_t));
+                }
+                return;
+            }
+            deallocateFrom<I + 1>(ptr, bytes);
+        }
+    }
+
+    std::tuple<GrowableMemoryPool<PoolBlock<BlockSizes>>...> pools;
+    std::pmr::memory_resource* upstream;
+};
+
+// Size classes suited to the nodes of the standard node-based containers
+using DefaultPoolMemoryResource = PoolMemoryResource<16, 32, 48, 64, 96, 128, 256, 512>;
+
+// Standard allocator over a PoolMemoryResource. Containers rebind it to
+// their node type, and every rebound copy shares the same resource, so node
+// allocations become O(1) pool operations without virtual dispatch.
+template <typename T, typename Resource = DefaultPoolMemoryResource>
+class PoolAllocator {
+public:
+    using value_type = T;
+
+    explicit PoolAllocator(Resource& resource) noexcept : resource(&resource) {}
+
+    template <typename U>
+    PoolAllocator(const PoolAllocator<U, Resource>& other) noexcept : resource(other.getResource()) {}
+
+    T* allocate(size_t n) {
+        if (n > static_cast<size_t>(-1) / sizeof(T)) {
+            throw std::bad_array_new_length();
+        }
+        return static_cast<T*>(resource->allocateBlock(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* ptr, size_t n) noexcept {
+        resource->deallocateBlock(ptr, n * sizeof(T), alignof(T));
+    }
+
+    Resource* getResource() const noexcept { return resource; }
+
+    template <typename U>
+    bool operator==(const PoolAllocator<U, Resource>& other) const noexcept {
+        return resource == other.getResource();
+    }
+
+private:
+    Resource* resource;
+};
@@ -0,0 +1,145 @@
+#pragma once
+#include <cstddef>
+#include <cstdlib>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
+
+// Backing-store policies supply the raw memory behind a pool.
+// A policy is a copyable object with
+//   void* allocate(size_t bytes, size_t alignment);   // nullptr on failure
+//   void release(void* memory, size_t bytes);
+// and is selected through Traits::Backing. alignment is a power of two.
+
+// Plain heap memory from std::malloc, or std::aligned_alloc for
+// alignments stricter than malloc guarantees
+struct MallocBacking {
+    void* allocate(size_t bytes, size_t alignment) {
+        if (alignment <= alignof(std::max_align_t)) {
+            return std::malloc(bytes);
+        }
+        return std::aligned_alloc(alignment, (bytes + alignment - 1) & ~(alignment - 1));
+    }
+
+    void release(void* memory, size_t) { std::free(memory); }
+};
+
+#if defined(__unix__) || defined(__APPLE__)
+// Address space reserved with an anonymous mapping. By default nothing is
+// committed up front: each page is faulted in on first touch, so resident
+// memory tracks the slots actually used. The options below trade that for
+// fewer TLB misses and no page faults after construction.
+struct MmapBacking {
+    bool hugePages = false;     // Back with huge pages (MAP_HUGETLB, else transparent huge pages)
+    bool populate = false;      // Pre-fault every page during construction
+    bool lockPages = false;     // mlock the range so it is never paged out
+    int numaNode = -1;          // Bind pages to this NUMA node (-1 = first touch)
+
+    static constexpr size_t hugePageSize = size_t{2} << 20;
+
+    // Mappings are page aligned; stricter alignments are not supported
+    void* allocate(size_t bytes, size_t alignment) {
+        if (alignment > static_cast<size_t>(sysconf(_SC_PAGESIZE))) {
+            return nullptr;
+        }
+        bytes = mappedSize(bytes);
+        int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+#ifdef MAP_NORESERVE
+        if (!populate && !lockPages) {
+            flags |= MAP_NORESERVE;
+        }
+#endif
+#ifdef MAP_POPULATE
+        // The kernel can pre-fault during mmap unless pages must wait for
+        // a NUMA binding or a transparent-huge-page hint to be applied first
+        bool kernelPopulate = populate && numaNode < 0 && !hugePages;
+        if (kernelPopulate) {
+            flags |= MAP_POPULATE;
+        }
+#else
+        bool kernelPopulate = false;
+#endif
+
+        void* memory = MAP_FAILED;
+#ifdef MAP_HUGETLB
+        // Explicit huge pages need a reserved pool; fall back when it is empty.
+        // The reservation must be checked now, or touching a page later can SIGBUS.
+        if (hugePages) {
+            int hugeFlags = flags | MAP_HUGETLB;
+#ifdef MAP_NORESERVE
+            hugeFlags &= ~MAP_NORESERVE;
+#endif
+            memory = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, hugeFlags, -1, 0);
+        }
+#endif
+        if (memory == MAP_FAILED) {
+            memory = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, flags, -1, 0);
+            if (memory == MAP_FAILED) {
+                return nullptr;
+            }
+#ifdef MADV_HUGEPAGE
+            if (hugePages) {
+                madvise(memory, bytes, MADV_HUGEPAGE);
+            }
+#endif
+        }
+
+        if (numaNode >= 0 && !bindToNode(memory, bytes)) {
+            munmap(memory, bytes);
+            return nullptr;
+        }
+        if (populate && !kernelPopulate) {
+            prefault(memory, bytes);
+        }
+        if (lockPages && mlock(memory, bytes) != 0) {
+            munmap(memory, bytes);
+            return nullptr;
+        }
+        return memory;
+    }
+
+    void release(void* memory, size_t bytes) {
+        if (memory != nullptr) {
+            munmap(memory, mappedSize(bytes));
+        }
+    }
+
+private:
+    // Huge-page mappings are rounded so release() unmaps exactly what was mapped
+    size_t mappedSize(size_t bytes) const {
+        return hugePages ? (bytes + hugePageSize - 1) & ~(hugePageSize - 1) : bytes;
+    }
+
+    bool bindToNode(void* memory, size_t bytes) const {
+#if defined(__linux__) && defined(SYS_mbind)
+        // mbind(2) called directly to avoid a libnuma link dependency
+        constexpr int mpolBind = 2;
+        constexpr size_t bitsPerWord = sizeof(unsigned long) * 8;
+        unsigned long nodeMask[16] = {};
+        if (static_cast<size_t>(numaNode) >= sizeof(nodeMask) * 8) {
+            return false;
+        }
+        nodeMask[numaNode / bitsPerWord] = 1UL << (numaNode % bitsPerWord);
+        return syscall(SYS_mbind, memory, bytes, mpolBind, nodeMask, sizeof(nodeMask) * 8, 0) == 0;
+#else
+        (void)memory;
+        (void)bytes;
+        return false;
+#endif
+    }
+
+    static void prefault(void* memory, size_t bytes) {
+        const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        volatile char* bytesPtr = static_cast<volatile char*>(memory);
+        for (size_t offset = 0; offset < bytes; offset += pageSize) {
+            bytesPtr[offset] = 0;
+        }
+    }
+};
+#endif
@@ -0,0 +1,8 @@
+#pragma once
+#include <cstddef>
+
+// Fixed-size, suitably aligned block used to instantiate byte pools
+template <size_t Size, size_t Align = alignof(std::max_align_t)>
+struct alignas(Align) PoolBlock {
+    unsigned char bytes[Size];
+};
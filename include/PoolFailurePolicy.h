@@ -0,0 +1,123 @@
+#pragma once
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <stdexcept>
+
+// What went wrong, as reported to a failure handler
+enum class PoolFailure {
+    Exhausted,          // allocate() found no free slot
+    ForeignPointer,     // deallocate() got a pointer outside the pool
+    MisalignedPointer,  // Hardened: pointer inside the pool but not at a slot start
+    DoubleFree,         // Hardened: slot was already free
+    UseAfterFree,       // Hardened: a free slot was written to
+    BufferOverflow      // Hardened: the guard canary after a slot was overwritten
+};
+
+inline const char* poolFailureMessage(PoolFailure failure) {
+    switch (failure) {
+    case PoolFailure::Exhausted: return "Memory pool is exhausted";
+    case PoolFailure::ForeignPointer: return "Pointer does not belong to this memory pool";
+    case PoolFailure::MisalignedPointer: return "Pointer does not point to the start of a pool slot";
+    case PoolFailure::DoubleFree: return "Pool slot was freed twice";
+    case PoolFailure::UseAfterFree: return "Pool slot was written to after being freed";
+    case PoolFailure::BufferOverflow: return "Guard canary after a pool slot was overwritten";
+    }
+    return "Unknown memory pool failure";
+}
+
+// Failure policies are selected through Traits::OnFailure and provide
+//   static void* onExhausted(size_t size, size_t alignment);
+//   static void onForeignPointer(void* ptr, size_t size, size_t alignment);
+//   static void onCorruption(PoolFailure failure, void* ptr);
+// The pool calls them from out-of-line cold paths only. onExhausted's result
+// is returned by allocate(). onCorruption reports hardened-mode findings; if
+// it returns, a misaligned or double free is ignored and other findings are
+// only reported. Deallocating nullptr is always a silent no-op.
+
+// Return nullptr when full; reject foreign pointers with std::invalid_argument
+struct ReturnNullPolicy {
+    static void* onExhausted(size_t, size_t) { return nullptr; }
+
+    static void onForeignPointer(void*, size_t, size_t) {
+        throw std::invalid_argument(poolFailureMessage(PoolFailure::ForeignPointer));
+    }
+
+    static void onCorruption(PoolFailure failure, void*) {
+        throw std::invalid_argument(poolFailureMessage(failure));
+    }
+};
+
+// Throw std::bad_alloc when full; reject foreign pointers with std::invalid_argument
+struct ThrowPolicy {
+    static void* onExhausted(size_t, size_t) { throw std::bad_alloc(); }
+
+    static void onForeignPointer(void* ptr, size_t size, size_t alignment) {
+        ReturnNullPolicy::onForeignPointer(ptr, size, alignment);
+    }
+
+    static void onCorruption(PoolFailure failure, void* ptr) {
+        ReturnNullPolicy::onCorruption(failure, ptr);
+    }
+};
+
+// Terminate on either failure
+struct AbortPolicy {
+    [[noreturn]] static void* onExhausted(size_t, size_t) {
+        onCorruption(PoolFailure::Exhausted, nullptr);
+    }
+
+    [[noreturn]] static void onForeignPointer(void*, size_t, size_t) {
+        onCorruption(PoolFailure::ForeignPointer, nullptr);
+    }
+
+    [[noreturn]] static void onCorruption(PoolFailure failure, void*) {
+        std::fprintf(stderr, "MemoryPool: %s\n", poolFailureMessage(failure));
+        std::abort();
+    }
+};
+
+// Report failures to a process-wide handler, then behave like ReturnNullPolicy
+// without throwing: allocate() returns nullptr and foreign pointers are ignored
+struct HandlerPolicy {
+    using Handler = void (*)(PoolFailure failure, void* ptr, size_t size);
+
+    static inline Handler handler = nullptr;
+
+    static void* onExhausted(size_t size, size_t) {
+        if (handler != nullptr) {
+            handler(PoolFailure::Exhausted, nullptr, size);
+        }
+        return nullptr;
+    }
+
+    static void onForeignPointer(void* ptr, size_t size, size_t) {
+        if (handler != nullptr) {
+            handler(PoolFailure::ForeignPointer, ptr, size);
+        }
+    }
+
+    static void onCorruption(PoolFailure failure, void* ptr) {
+        if (handler != nullptr) {
+            handler(failure, ptr, 0);
+        }
+    }
+};
+
+// Fall back to the global heap when full. deallocate() hands any pointer
+// outside the pool to ::operator delete, so fallback objects are freed
+// through the pool like pooled ones.
+struct FallbackNewPolicy {
+    static void* onExhausted(size_t size, size_t alignment) {
+        return ::operator new(size, std::align_val_t(alignment));
+    }
+
+    static void onForeignPointer(void* ptr, size_t size, size_t alignment) {
+        ::operator delete(ptr, size, std::align_val_t(alignment));
+    }
+
+    static void onCorruption(PoolFailure failure, void* ptr) {
+        ReturnNullPolicy::onCorruption(failure, ptr);
+    }
+};
@@ -0,0 +1,34 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+// Compact reference to a pool slot: the slot index in the low IndexBits
+// bits and the slot's generation in the rest. A pool bumps a slot's
+// generation whenever the slot is freed, so a handle kept past the free
+// no longer resolves. Generations start at 1, so the all-zero handle is
+// null. After 2^generationBits - 1 reuses of one slot a stale handle
+// matches again.
+template <typename Storage = uint32_t, unsigned IndexBits = 20>
+struct PoolHandle {
+    static_assert(std::is_unsigned_v<Storage>, "Handle storage must be an unsigned integer");
+    static_assert(IndexBits > 0 && IndexBits < sizeof(Storage) * 8, "Handles need both index and generation bits");
+
+    using StorageType = Storage;
+    static constexpr unsigned indexBits = IndexBits;
+    static constexpr unsigned generationBits = sizeof(Storage) * 8 - IndexBits;
+    static constexpr size_t maxSlots = size_t{1} << IndexBits;
+    static constexpr Storage maxGeneration = static_cast<Storage>((Storage{1} << generationBits) - 1);
+
+    Storage value = 0;
+
+    static constexpr PoolHandle make(size_t index, Storage generation) {
+        return PoolHandle{static_cast<Storage>((generation << IndexBits) | static_cast<Storage>(index))};
+    }
+
+    constexpr size_t index() const { return value & (maxSlots - 1); }
+    constexpr Storage generation() const { return static_cast<Storage>(value >> IndexBits); }
+
+    constexpr explicit operator bool() const { return value != 0; }
+    friend constexpr bool operator==(PoolHandle, PoolHandle) = default;
+};
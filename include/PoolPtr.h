@@ -0,0 +1,51 @@
+#pragma once
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+// Owning handles for objects made by a pool's create(). The deleters hand
+// objects back to destroy(), so any pool type providing both works.
+
+// Deleter bound to a pool at run time; costs one pointer per handle
+template <typename Pool>
+class PoolDeleter {
+public:
+    PoolDeleter() noexcept : pool(nullptr) {}
+    explicit PoolDeleter(Pool* pool) noexcept : pool(pool) {}
+
+    template <typename T>
+    void operator()(T* ptr) const { pool->destroy(ptr); }
+
+    Pool* getPool() const noexcept { return pool; }
+
+private:
+    Pool* pool;
+};
+
+// Deleter bound to a pool with static storage duration at compile time;
+// stateless, so the handle is the size of a raw pointer
+template <auto& pool>
+struct StaticPoolDeleter {
+    template <typename T>
+    void operator()(T* ptr) const { pool.destroy(ptr); }
+};
+
+template <typename T, typename Pool>
+using PoolUniquePtr = std::unique_ptr<T, PoolDeleter<Pool>>;
+
+template <typename T, auto& pool>
+using StaticPoolUniquePtr = std::unique_ptr<T, StaticPoolDeleter<pool>>;
+
+// Construct an object in the pool and wrap it in an owning handle;
+// the handle is empty when the pool is full
+template <typename Pool, typename... Args>
+auto makePoolUnique(Pool& pool, Args&&... args) {
+    using T = std::remove_pointer_t<decltype(pool.create(std::forward<Args>(args)...))>;
+    return PoolUniquePtr<T, Pool>(pool.create(std::forward<Args>(args)...), PoolDeleter<Pool>(&pool));
+}
+
+template <auto& pool, typename... Args>
+auto makeStaticPoolUnique(Args&&... args) {
+    using T = std::remove_pointer_t<decltype(pool.create(std::forward<Args>(args)...))>;
+    return StaticPoolUniquePtr<T, pool>(pool.create(std::forward<Args>(args)...));
+}
@@ -0,0 +1,235 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+// Point-in-time view of one pool's counters
+struct PoolStatsSnapshot {
+    static constexpr size_t latencyBuckets = 32;
+
+    const char* name = nullptr;     // Label given with setName(), if any
+    size_t objectSize = 0;          // Slot stride in bytes
+    size_t poolSize = 0;            // Total number of slots
+    uint64_t allocations = 0;       // Successful allocations
+    uint64_t deallocations = 0;     // Deallocations
+    uint64_t failures = 0;          // Allocations refused because the pool was full
+    uint64_t inUse = 0;             // Slots currently allocated
+    uint64_t highWaterMark = 0;     // Most slots ever allocated at once
+
+    // Sampled allocate() latency: bucket 0 counts samples in [0, 2) ns,
+    // bucket i in [2^i, 2^(i+1)) ns, and the last bucket everything above
+    uint64_t latencySamples = 0;
+    uint64_t latencyHistogram[latencyBuckets] = {};
+};
+
+class PoolStats;
+
+// Process-wide list of pools with statistics enabled, for metrics exporters.
+// The lock is only taken when a pool is created or destroyed and while
+// scraping, never on a pool's allocate/deallocate path.
+class PoolRegistry {
+public:
+    static PoolRegistry& instance() {
+        static PoolRegistry registry;
+        return registry;
+    }
+
+    // Call f(const PoolStatsSnapshot&) for every live pool
+    template <typename F>
+    void forEach(F&& f);
+
+    // Number of live pools with statistics enabled
+    size_t size() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return count;
+    }
+
+private:
+    friend class PoolStats;
+
+    void add(PoolStats* stats);
+    void remove(PoolStats* stats);
+
+    std::mutex mutex;
+    PoolStats* head = nullptr;
+    size_t count = 0;
+};
+
+// Statistics policies are selected through Traits::Stats. A pool calls
+//   attach(poolSize, objectSize)    once, from its constructor
+//   beginSample() / endSample(token) around the body of allocate()
+//   recordAllocate(count, inUse)    after handing out count slots
+//   recordDeallocate(count)         after taking back count slots
+//   recordFailure()                 when an allocation is refused
+// and exposes snapshot() through MemoryPool::getStats().
+
+// Statistics disabled: every hook is an empty inline function
+struct NoPoolStats {
+    static constexpr bool enabled = false;
+
+    void attach(size_t, size_t) {}
+    void setName(const char*) {}
+    uint64_t beginSample() { return 0; }
+    void endSample(uint64_t) {}
+    void recordAllocate(size_t, size_t) {}
+    void recordDeallocate(size_t) {}
+    void recordFailure() {}
+    PoolStatsSnapshot snapshot() const { return {}; }
+};
+
+// Counters for one pool, registered with PoolRegistry for its lifetime.
+// A MemoryPool is owned by one thread at a time, so each counter has a
+// single writer: updates are relaxed load+store pairs rather than locked
+// read-modify-writes, and a scraping thread reads them with relaxed loads.
+class PoolStats {
+public:
+    static constexpr bool enabled = true;
+
+    PoolStats() = default;
+    PoolStats(const PoolStats&) = delete;
+    PoolStats& operator=(const PoolStats&) = delete;
+
+    ~PoolStats() {
+        if (attached) {
+            PoolRegistry::instance().remove(this);
+        }
+    }
+
+    void attach(size_t poolSize, size_t objectSize) {
+        this->poolSize = poolSize;
+        this->objectSize = objectSize;
+        attached = true;
+        PoolRegistry::instance().add(this);
+    }
+
+    // Label reported in snapshots; the string must outlive the pool
+    void setName(const char* name) { this->name.store(name, std::memory_order_relaxed); }
+
+    uint64_t beginSample() { return 0; }
+    void endSample(uint64_t) {}
+
+    void recordAllocate(size_t count, size_t inUse) {
+        bump(allocations, count);
+        if (inUse > highWaterMark.load(std::memory_order_relaxed)) {
+            highWaterMark.store(inUse, std::memory_order_relaxed);
+        }
+    }
+
+    void recordDeallocate(size_t count) { bump(deallocations, count); }
+
+    void recordFailure() { bump(failures, 1); }
+
+    PoolStatsSnapshot snapshot() const {
+        PoolStatsSnapshot result;
+        result.name = name.load(std::memory_order_relaxed);
+        result.objectSize = objectSize;
+        result.poolSize = poolSize;
+        result.allocations = allocations.load(std::memory_order_relaxed);
+        result.deallocations = deallocations.load(std::memory_order_relaxed);
+        result.failures = failures.load(std::memory_order_relaxed);
+        result.inUse = result.allocations >= result.deallocations ? result.allocations - result.deallocations : 0;
+        result.highWaterMark = highWaterMark.load(std::memory_order_relaxed);
+        result.latencySamples = latencySamples.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < PoolStatsSnapshot::latencyBuckets; ++i) {
+            result.latencyHistogram[i] = latencyHistogram[i].load(std::memory_order_relaxed);
+        }
+        return result;
+    }
+
+protected:
+    static void bump(std::atomic<uint64_t>& counter, uint64_t amount) {
+        counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+    }
+
+    // Filled only by SampledPoolStats
+    std::atomic<uint64_t> latencySamples{0};
+    std::atomic<uint64_t> latencyHistogram[PoolStatsSnapshot::latencyBuckets] = {};
+
+private:
+    friend class PoolRegistry;
+
+    std::atomic<uint64_t> allocations{0};
+    std::atomic<uint64_t> deallocations{0};
+    std::atomic<uint64_t> failures{0};
+    std::atomic<uint64_t> highWaterMark{0};
+    std::atomic<const char*> name{nullptr};
+    size_t poolSize = 0;
+    size_t objectSize = 0;
+    bool attached = false;
+
+    // Links in PoolRegistry, guarded by its mutex
+    PoolStats* prev = nullptr;
+    PoolStats* next = nullptr;
+};
+
+// PoolStats plus a latency histogram of one allocate() in every SampleEvery
+template <unsigned SampleEvery = 1024>
+class SampledPoolStats : public PoolStats {
+public:
+    static_assert(SampleEvery > 0 && (SampleEvery & (SampleEvery - 1)) == 0,
+                  "Sampling interval must be a power of two");
+
+    // Returns a start timestamp for sampled calls, otherwise 0
+    uint64_t beginSample() {
+        if ((++sampleCounter & (SampleEvery - 1)) != 0) {
+            return 0;
+        }
+        return now();
+    }
+
+    void endSample(uint64_t start) {
+        if (start == 0) {
+            return;
+        }
+        uint64_t elapsed = now() - start;
+        size_t bucket = 0;
+        while (elapsed > 1 && bucket + 1 < PoolStatsSnapshot::latencyBuckets) {
+            elapsed >>= 1;
+            ++bucket;
+        }
+        bump(latencyHistogram[bucket], 1);
+        bump(latencySamples, 1);
+    }
+
+private:
+    static uint64_t now() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    unsigned sampleCounter = 0;
+};
+
+inline void PoolRegistry::add(PoolStats* stats) {
+    std::lock_guard<std::mutex> lock(mutex);
+    stats->prev = nullptr;
+    stats->next = head;
+    if (head != nullptr) {
+        head->prev = stats;
+    }
+    head = stats;
+    ++count;
+}
+
+inline void PoolRegistry::remove(PoolStats* stats) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (stats->prev != nullptr) {
+        stats->prev->next = stats->next;
+    } else {
+        head = stats->next;
+    }
+    if (stats->next != nullptr) {
+        stats->next->prev = stats->prev;
+    }
+    --count;
+}
+
+template <typename F>
+void PoolRegistry::forEach(F&& f) {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (PoolStats* stats = head; stats != nullptr; stats = stats->next) {
+        f(stats->snapshot());
+    }
+}
@@ -0,0 +1,91 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include "PoolBacking.h"
+#include "PoolFailurePolicy.h"
+#include "PoolHandle.h"
+#include "PoolStats.h"
+
+// Assumed size of a cache line, used to keep data touched by different
+// threads, or hot and cold data, on separate lines
+constexpr size_t cacheLineSize = 64;
+
+// Where MemoryPool keeps the links of its free list
+enum class FreeListMode {
+    OffsetArray,    // Separate array of free slot indices used as a stack
+    Intrusive,      // Each free slot stores the index of the next free slot
+    Bitmap          // One bit per free slot; the lowest free slot is reused first
+};
+
+// Compile-time configuration for MemoryPool<T, Traits>.
+// Derive from DefaultPoolTraits and override only the members to change.
+struct DefaultPoolTraits {
+    // Free-list storage mode
+    static constexpr FreeListMode freeList = FreeListMode::OffsetArray;
+
+    // Integer type used for slot indices; limits the pool size
+    using IndexType = size_t;
+
+    // Source of the slab and free-list memory
+    using Backing = MallocBacking;
+
+    // Slot alignment: 0 for alignof(T), otherwise a power of two. The slot
+    // stride is rounded up to it. At cacheLineSize or above, the pool's
+    // mutable counters also get a cache line to themselves.
+    static constexpr size_t alignment = 0;
+
+    // Statistics policy: NoPoolStats compiles every hook away
+    using Stats = NoPoolStats;
+
+    // What allocate() does when full and deallocate() does with a foreign pointer
+    using OnFailure = ReturnNullPolicy;
+
+    // Hardened mode: allocation bitmap, alignment checks, poison-on-free,
+    // guard canaries and ASan annotations. Findings go to OnFailure::onCorruption.
+    static constexpr bool hardened = false;
+
+    // Handle type for allocateHandle()/resolve(), e.g. PoolHandle<>; void
+    // disables handles and their per-slot generation counters
+    using Handle = void;
+};
+
+// Zero per-slot overhead: links live inside free slots as 32-bit indices
+struct IntrusivePoolTraits : DefaultPoolTraits {
+    static constexpr FreeListMode freeList = FreeListMode::Intrusive;
+    using IndexType = uint32_t;
+};
+
+// Live objects stay packed at the low end of the slab and can be visited
+// in address order with forEachLive()
+struct AddressOrderedPoolTraits : DefaultPoolTraits {
+    static constexpr FreeListMode freeList = FreeListMode::Bitmap;
+};
+
+// Every slot starts on its own cache line, so objects handed to different
+// threads never share one
+struct CacheAlignedPoolTraits : DefaultPoolTraits {
+    static constexpr size_t alignment = cacheLineSize;
+};
+
+// Counters and registration with PoolRegistry
+struct InstrumentedPoolTraits : DefaultPoolTraits {
+    using Stats = PoolStats;
+};
+
+// Every corruption check enabled, for debug and staging builds
+struct HardenedPoolTraits : DefaultPoolTraits {
+    static constexpr bool hardened = true;
+};
+
+// 32-bit generational handles: up to 2^20 slots, 4095 reuses per slot
+// before a stale handle can match again
+struct HandlePoolTraits : DefaultPoolTraits {
+    using Handle = PoolHandle<uint32_t, 20>;
+};
+
+#if defined(__unix__) || defined(__APPLE__)
+// Slab and free list reserved with mmap and faulted in on first touch
+struct MmapPoolTraits : DefaultPoolTraits {
+    using Backing = MmapBacking;
+};
+#endif
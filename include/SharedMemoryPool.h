@@ -0,0 +1,153 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include "PoolTraits.h"
+#include "TaggedIndexStack.h"
+
+// How SharedMemoryPool finds its region
+enum class SharedPoolOpen {
+    Create,         // Create a new region; fail if the name exists
+    Open,           // Attach to an existing region; fail if it is missing
+    OpenOrCreate    // Attach if the region exists, otherwise create it
+};
+
+// Where the region lives
+enum class SharedPoolBacking {
+    PosixShm,       // shm_open object, e.g. "/orders"; lost on reboot
+    File            // Ordinary file path; survives reboots on a persistent filesystem
+};
+
+// MemoryPool whose slab and free list live in a named shared mapping, so
+// several processes can allocate from it at once and a restarted process
+// finds its objects where it left them.
+//
+// The region holds only offsets, never pointers: each process maps it at
+// its own address, and objects are passed between processes as offsets
+// (toOffset/fromOffset). T must therefore be trivially copyable and must
+// not hold pointers into the region itself.
+//
+// The free list is the lock-free TaggedIndexStack used by
+// ConcurrentMemoryPool, operating on 64-bit atomics that are address-free,
+// so allocate() and deallocate() are safe across processes without locks.
+// POSIX only.
+template <typename T>
+class SharedMemoryPool {
+    static_assert(std::is_trivially_copyable_v<T>, "Objects in shared memory must be trivially copyable");
+
+public:
+    // Constructor: attaches to or creates the named region. Creating sizes
+    // the region for poolSize objects; attaching checks that the existing
+    // region was made for the same T and poolSize (0 accepts any size).
+    // Throws std::system_error when the region cannot be opened or mapped,
+    // and std::runtime_error when an existing region does not match.
+    SharedMemoryPool(const std::string& name, size_t poolSize,
+                     SharedPoolOpen mode = SharedPoolOpen::OpenOrCreate,
+                     SharedPoolBacking location = SharedPoolBacking::PosixShm);
+
+    // Destructor: unmaps the region; the region and its objects persist
+    ~SharedMemoryPool();
+
+    SharedMemoryPool(const SharedMemoryPool&) = delete;
+    SharedMemoryPool& operator=(const SharedMemoryPool&) = delete;
+
+    // Remove a named region; processes that have it mapped keep their mapping
+    static bool remove(const std::string& name, SharedPoolBacking location = SharedPoolBacking::PosixShm);
+
+    // Allocate memory for an object of type T; returns nullptr when exhausted
+    T* allocate();
+
+    // Free memory and return it to the pool; callable from any process
+    void deallocate(T* ptr);
+
+    // Position-independent reference to an object, valid in every process
+    // attached to the region
+    uint64_t toOffset(const T* ptr) const {
+        return static_cast<uint64_t>(reinterpret_cast<const char*>(ptr) - region);
+    }
+
+    // Object at an offset obtained from toOffset(), possibly in another process
+    T* fromOffset(uint64_t offset) const {
+        return reinterpret_cast<T*>(region + offset);
+    }
+
+    // Check whether a pointer lies inside this pool's slab
+    bool owns(const T* ptr) const {
+        return reinterpret_cast<uintptr_t>(ptr) - reinterpret_cast<uintptr_t>(slab) < header->poolSize * objectSize;
+    }
+
+    // Call f(T*) for every allocated slot. Only consistent while no other
+    // process is allocating or freeing.
+    template <typename F>
+    void forEachLive(F&& f);
+
+    // Rebuild the free list after a crash: every slot not marked allocated
+    // is freed, including slots a dead process had popped but not yet
+    // marked, and allocated slots for which keep(T*) returns false are
+    // freed too. Must run while no other process uses the pool.
+    template <typename F>
+    void recover(F&& keep);
+
+    // Check whether this process created the region rather than attaching
+    bool createdRegion() const { return created; }
+
+    // Get the total pool size
+    size_t getPoolSize() const { return static_cast<size_t>(header->poolSize); }
+
+    // Get the number of available slots (a snapshot under concurrent use)
+    size_t getAvailableSlots() const { return static_cast<size_t>(header->availableSlots.load(std::memory_order_relaxed)); }
+
+    // Check if pool is full
+    bool isFull() const { return getAvailableSlots() == 0; }
+
+    // Check if pool is empty
+    bool isEmpty() const { return getAvailableSlots() == getPoolSize(); }
+
+private:
+    static constexpr uint64_t magicValue = 0x4C4F4F504D454D53ull;   // "SMEMPOOL"
+    static constexpr uint32_t layoutVersion = 1;
+
+    // Link value of a slot that is handed out rather than on the free list
+    static constexpr uint32_t allocatedMark = TaggedIndexStack::nullIndex - 1;
+
+    // Start of the region. Holds only offsets and address-free atomics.
+    struct Header {
+        uint64_t magic;
+        uint32_t version;
+        std::atomic<uint32_t> ready;        // Set once the creator has initialized the region
+        uint64_t objectSize;
+        uint64_t objectAlign;
+        uint64_t poolSize;
+        uint64_t linksOffset;               // Offset of the link array
+        uint64_t slabOffset;                // Offset of the first slot
+        uint64_t regionBytes;
+
+        alignas(cacheLineSize) TaggedIndexStack freeStack;
+        alignas(cacheLineSize) std::atomic<uint64_t> availableSlots;
+    };
+
+    static_assert(std::is_standard_layout_v<Header>, "Shared header must be standard layout");
+    static_assert(std::atomic<uint32_t>::is_always_lock_free, "Shared links require lock-free 32-bit atomics");
+
+    static int openRegion(const std::string& name, int flags, SharedPoolBacking location);
+    static size_t regionSize(size_t poolSize, uint64_t& linksOffset, uint64_t& slabOffset);
+    void initializeRegion(size_t poolSize);
+    void attachRegion(size_t poolSize);
+
+    std::string name;                   // Name the region was opened under
+    char* region;                       // This process's mapping of the region
+    size_t mappedBytes;                 // Length of the mapping
+    Header* header;                     // Shared bookkeeping at the start of the region
+    std::atomic<uint32_t>* links;       // Free-list link for each slot
+    char* slab;                         // First slot
+    bool created;                       // This process created the region
+
+    // Size of each object
+    static constexpr size_t objectSize = sizeof(T);
+};
+
+#include "SharedMemoryPool.hpp"
@@ -0,0 +1,237 @@
+#pragma once
+#include <cerrno>
+#include <chrono>
+#include <new>
+#include <thread>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+template <typename T>
+SharedMemoryPool<T>::SharedMemoryPool(const std::string& name, size_t poolSize,
+                                      SharedPoolOpen mode, SharedPoolBacking location)
+    : name(name), region(nullptr), mappedBytes(0), header(nullptr), links(nullptr), slab(nullptr), created(false) {
+
+    if (poolSize == 0 && mode != SharedPoolOpen::Open) {
+        throw std::invalid_argument("Pool size must be greater than 0");
+    }
+    if (poolSize >= allocatedMark) {
+        throw std::invalid_argument("Pool size must fit in a 32-bit slot index");
+    }
+
+    // Exactly one process wins O_EXCL and initializes the region
+    int fd = -1;
+    if (mode != SharedPoolOpen::Open) {
+        fd = openRegion(name, O_RDWR | O_CREAT | O_EXCL, location);
+        created = fd >= 0;
+        if (fd < 0 && (errno != EEXIST || mode == SharedPoolOpen::Create)) {
+            throw std::system_error(errno, std::generic_category(), "Cannot create shared pool " + name);
+        }
+    }
+    if (fd < 0) {
+        fd = openRegion(name, O_RDWR, location);
+        if (fd < 0) {
+            throw std::system_error(errno, std::generic_category(), "Cannot open shared pool " + name);
+        }
+    }
+
+    auto fail = [&](int error, const char* what) {
+        ::close(fd);
+        if (created) {
+            remove(name, location);
+        }
+        throw std::system_error(error, std::generic_category(), what + name);
+    };
+
+    if (created) {
+        uint64_t linksOffset;
+        uint64_t slabOffset;
+        mappedBytes = regionSize(poolSize, linksOffset, slabOffset);
+        if (::ftruncate(fd, static_cast<off_t>(mappedBytes)) != 0) {
+            fail(errno, "Cannot size shared pool ");
+        }
+    } else {
+        // The creator may not have sized the region yet
+        struct stat info;
+        for (int attempt = 0; attempt < 1000; ++attempt) {
+            if (::fstat(fd, &info) != 0) {
+                fail(errno, "Cannot stat shared pool ");
+            }
+            if (info.st_size > 0) {
+                break;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        if (info.st_size < static_cast<off_t>(sizeof(Header))) {
+            fail(EINVAL, "Shared pool region is too small: ");
+        }
+        mappedBytes = static_cast<size_t>(info.st_size);
+    }
+
+    void* mapping = ::mmap(nullptr, mappedBytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (mapping == MAP_FAILED) {
+        fail(errno, "Cannot map shared pool ");
+    }
+    ::close(fd);
+    region = static_cast<char*>(mapping);
+    header = reinterpret_cast<Header*>(region);
+
+    try {
+        if (created) {
+            initializeRegion(poolSize);
+        } else {
+            attachRegion(poolSize);
+        }
+    } catch (...) {
+        ::munmap(region, mappedBytes);
+        if (created) {
+            remove(name, location);
+        }
+        throw;
+    }
+}
+
+template <typename T>
+SharedMemoryPool<T>::~SharedMemoryPool() {
+    ::munmap(region, mappedBytes);
+}
+
+template <typename T>
+int SharedMemoryPool<T>::openRegion(const std::string& name, int flags, SharedPoolBacking location) {
+    if (location == SharedPoolBacking::PosixShm) {
+        return ::shm_open(name.c_str(), flags, 0600);
+    }
+    return ::open(name.c_str(), flags, 0600);
+}
+
+template <typename T>
+bool SharedMemoryPool<T>::remove(const std::string& name, SharedPoolBacking location) {
+    if (location == SharedPoolBacking::PosixShm) {
+        return ::shm_unlink(name.c_str()) == 0;
+    }
+    return ::unlink(name.c_str()) == 0;
+}
+
+template <typename T>
+size_t SharedMemoryPool<T>::regionSize(size_t poolSize, uint64_t& linksOffset, uint64_t& slabOffset) {
+    // Header, then the link array, then the slab on its own cache line
+    linksOffset = sizeof(Header);
+    const uint64_t linksEnd = linksOffset + poolSize * sizeof(std::atomic<uint32_t>);
+    const uint64_t slabAlign = alignof(T) > cacheLineSize ? alignof(T) : cacheLineSize;
+    slabOffset = (linksEnd + slabAlign - 1) & ~(slabAlign - 1);
+    return static_cast<size_t>(slabOffset + poolSize * objectSize);
+}
+
+template <typename T>
+void SharedMemoryPool<T>::initializeRegion(size_t poolSize) {
+    new (header) Header{};
+    header->magic = magicValue;
+    header->version = layoutVersion;
+    header->objectSize = objectSize;
+    header->objectAlign = alignof(T);
+    header->poolSize = poolSize;
+    header->regionBytes = regionSize(poolSize, header->linksOffset, header->slabOffset);
+
+    links = reinterpret_cast<std::atomic<uint32_t>*>(region + header->linksOffset);
+    slab = region + header->slabOffset;
+    for (size_t i = 0; i < poolSize; ++i) {
+        new (&links[i]) std::atomic<uint32_t>(0);
+    }
+    header->freeStack.initialize(links, static_cast<uint32_t>(poolSize));
+    header->availableSlots.store(poolSize, std::memory_order_relaxed);
+
+    // Publish: attaching processes wait for this before touching anything
+    header->ready.store(1, std::memory_order_release);
+}
+
+template <typename T>
+void SharedMemoryPool<T>::attachRegion(size_t poolSize) {
+    // Give a creator that is still initializing a moment to finish
+    for (int attempt = 0; attempt < 1000 && header->ready.load(std::memory_order_acquire) == 0; ++attempt) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    if (header->ready.load(std::memory_order_acquire) == 0) {
+        throw std::runtime_error("Shared pool " + name + " was never initialized; remove it and recreate");
+    }
+    if (header->magic != magicValue || header->version != layoutVersion) {
+        throw std::runtime_error("Shared pool " + name + " has an unknown layout");
+    }
+    if (header->objectSize != objectSize || header->objectAlign != alignof(T)) {
+        throw std::runtime_error("Shared pool " + name + " holds a different object type");
+    }
+    if ((poolSize != 0 && header->poolSize != poolSize) || header->regionBytes > mappedBytes) {
+        throw std::runtime_error("Shared pool " + name + " has a different size");
+    }
+
+    links = reinterpret_cast<std::atomic<uint32_t>*>(region + header->linksOffset);
+    slab = region + header->slabOffset;
+}
+
+template <typename T>
+T* SharedMemoryPool<T>::allocate() {
+    uint32_t index = header->freeStack.pop(links);
+    if (index == TaggedIndexStack::nullIndex) {
+        return nullptr; // Pool is full
+    }
+
+    // Mark the slot handed out so deallocate, forEachLive and recover can tell
+    links[index].store(allocatedMark, std::memory_order_release);
+    header->availableSlots.fetch_sub(1, std::memory_order_relaxed);
+    return reinterpret_cast<T*>(slab + index * objectSize);
+}
+
+template <typename T>
+void SharedMemoryPool<T>::deallocate(T* ptr) {
+    if (ptr == nullptr) {
+        return;
+    }
+
+    // Validate that the pointer belongs to this pool
+    if (!owns(ptr)) {
+        throw std::invalid_argument("Pointer does not belong to this memory pool");
+    }
+
+    size_t offset = static_cast<size_t>(reinterpret_cast<char*>(ptr) - slab) / objectSize;
+    // Claim the slot before pushing it, so when two processes free the same
+    // slot at once only one of them puts it back on the free list
+    uint32_t expected = allocatedMark;
+    if (!links[offset].compare_exchange_strong(expected, TaggedIndexStack::nullIndex,
+                                               std::memory_order_acquire, std::memory_order_relaxed)) {
+        throw std::invalid_argument("Pointer is not allocated from this memory pool");
+    }
+    header->availableSlots.fetch_add(1, std::memory_order_relaxed);
+    header->freeStack.push(links, static_cast<uint32_t>(offset));
+}
+
+template <typename T>
+template <typename F>
+void SharedMemoryPool<T>::forEachLive(F&& f) {
+    for (size_t i = 0; i < header->poolSize; ++i) {
+        if (links[i].load(std::memory_order_acquire) == allocatedMark) {
+            f(reinterpret_cast<T*>(slab + i * objectSize));
+        }
+    }
+}
+
+template <typename T>
+template <typename F>
+void SharedMemoryPool<T>::recover(F&& keep) {
+    // Relink every slot that is not kept, lowest index on top
+    uint32_t first = TaggedIndexStack::nullIndex;
+    uint64_t freeCount = 0;
+    for (size_t i = header->poolSize; i-- > 0;) {
+        T* obj = reinterpret_cast<T*>(slab + i * objectSize);
+        if (links[i].load(std::memory_order_relaxed) == allocatedMark && keep(obj)) {
+            continue;
+        }
+        links[i].store(first, std::memory_order_relaxed);
+        first = static_cast<uint32_t>(i);
+        freeCount++;
+    }
+
+    uint64_t head = header->freeStack.head.load(std::memory_order_relaxed);
+    header->availableSlots.store(freeCount, std::memory_order_relaxed);
+    header->freeStack.head.store(TaggedIndexStack::pack(first, TaggedIndexStack::tagOf(head) + 1),
+                                 std::memory_order_release);
+}
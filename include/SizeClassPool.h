@@ -0,0 +1,206 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <tuple>
+#include <utility>
+#include "MemoryPool.h"
+#include "PoolBlock.h"
+
+// Slab-allocator style size classes: 16-byte steps up to 128, then four
+// classes per power of two up to 4096
+inline constexpr size_t sizeClassBytes[] = {
+    8, 16, 32, 48, 64, 80, 96, 112, 128,
+    160, 192, 224, 256, 320, 384, 448, 512,
+    640, 768, 896, 1024, 1280, 1536, 1792, 2048,
+    2560, 3072, 3584, 4096
+};
+
+// General-purpose allocator for small blocks built from one fixed-size
+// MemoryPool per size class. A request is mapped to its class with a single
+// table lookup computed at compile time. Each class keeps a small stack of
+// ready blocks in front of its pool, refilled and drained with the pools'
+// batch calls, so the common path indexes arrays by class instead of
+// dispatching to a differently typed pool per call. Requests above 4096
+// bytes, and requests for a class whose pool is exhausted, fall back to
+// std::malloc. Blocks of 16 bytes or more are aligned to
+// alignof(std::max_align_t). Not thread-safe, like the pools it owns.
+template <typename Traits = IntrusivePoolTraits>
+class SizeClassPool {
+public:
+    static constexpr size_t classCount = std::size(sizeClassBytes);
+    static constexpr size_t maxBlockSize = sizeClassBytes[classCount - 1];
+
+    // Constructor: reserves bytesPerClass bytes of slots for every class;
+    // memory is only touched as blocks are used
+    explicit SizeClassPool(size_t bytesPerClass)
+        : SizeClassPool(bytesPerClass, std::make_index_sequence<classCount>()) {}
+
+    // Destructor: returns cached blocks; slabs are released by the pools
+    ~SizeClassPool() {
+        for (size_t sizeClass = 0; sizeClass < classCount; ++sizeClass) {
+            drainFns[sizeClass](*this, caches[sizeClass].count);
+        }
+    }
+
+    SizeClassPool(const SizeClassPool&) = delete;
+    SizeClassPool& operator=(const SizeClassPool&) = delete;
+
+    // Allocate at least size bytes; returns nullptr only when malloc fails
+    void* allocate(size_t size) {
+        if (size > maxBlockSize) {
+            return std::malloc(size);
+        }
+        const size_t sizeClass = classOf(size);
+        BlockCache& cache = caches[sizeClass];
+        if (cache.count == 0) {
+            refillFns[sizeClass](*this);
+            if (cache.count == 0) {
+                return std::malloc(sizeClassBytes[sizeClass]);
+            }
+        }
+        return cache.blocks[--cache.count];
+    }
+
+    // Free a block; size must be the size passed to allocate()
+    void deallocate(void* ptr, size_t size) {
+        if (ptr == nullptr) {
+            return;
+        }
+        if (size > maxBlockSize) {
+            std::free(ptr);
+            return;
+        }
+        const size_t sizeClass = classOf(size);
+        BlockCache& cache = caches[sizeClass];
+        if (cache.count == cacheCapacity) {
+            drainFns[sizeClass](*this, cacheCapacity / 2);
+        }
+        cache.blocks[cache.count++] = ptr;
+    }
+
+    // Size class index serving a request of size bytes (size <= maxBlockSize)
+    static constexpr size_t classOf(size_t size) {
+        return classTable[(size + granule - 1) / granule];
+    }
+
+    // Block size of a class
+    static constexpr size_t classSize(size_t sizeClass) { return sizeClassBytes[sizeClass]; }
+
+    // Get the number of blocks a class can hand out before calling malloc
+    size_t getAvailableBlocks(size_t sizeClass) const {
+        return availableFns[sizeClass](*this) + caches[sizeClass].count;
+    }
+
+private:
+    static constexpr size_t granule = 8;
+
+    // classTable[i] is the smallest class holding i * granule bytes
+    static constexpr auto classTable = [] {
+        std::array<uint8_t, maxBlockSize / granule + 1> table{};
+        size_t sizeClass = 0;
+        for (size_t i = 0; i < table.size(); ++i) {
+            while (sizeClassBytes[sizeClass] < i * granule) {
+                ++sizeClass;
+            }
+            table[i] = static_cast<uint8_t>(sizeClass);
+        }
+        return table;
+    }();
+
+    template <size_t Size>
+    using Block = PoolBlock<Size, (Size < alignof(std::max_align_t) ? Size : alignof(std::max_align_t))>;
+
+    template <size_t... Classes>
+    using PoolTuple = std::tuple<MemoryPool<Block<sizeClassBytes[Classes]>, Traits>...>;
+
+    template <size_t... Classes>
+    static PoolTuple<Classes...> poolTupleFor(std::index_sequence<Classes...>);
+
+    using Pools = decltype(poolTupleFor(std::make_index_sequence<classCount>()));
+
+    static constexpr size_t cacheCapacity = 32;
+
+    // Ready blocks of one class. Blocks from a malloc fallback are sized to
+    // the class, so they can sit here alongside pool blocks.
+    struct BlockCache {
+        size_t count = 0;
+        void* blocks[cacheCapacity];
+    };
+
+    template <size_t... Classes>
+    SizeClassPool(size_t bytesPerClass, std::index_sequence<Classes...>)
+        : pools(blockCount(bytesPerClass, sizeClassBytes[Classes])...) {}
+
+    static size_t blockCount(size_t bytesPerClass, size_t blockSize) {
+        return bytesPerClass / blockSize > 0 ? bytesPerClass / blockSize : 1;
+    }
+
+    // Per-class slow paths, gathered into jump tables indexed by class
+
+    // Move up to half a cache of blocks out of the pool
+    template <size_t Class>
+    static void refill(SizeClassPool& self) {
+        auto& pool = std::get<Class>(self.pools);
+        BlockCache& cache = self.caches[Class];
+        size_t count = pool.getAvailableSlots() < cacheCapacity / 2 ? pool.getAvailableSlots() : cacheCapacity / 2;
+        using BlockPtr = Block<sizeClassBytes[Class]>*;
+        BlockPtr blocks[cacheCapacity / 2];
+        if (count != 0 && pool.allocateN(blocks, count)) {
+            for (size_t i = 0; i < count; ++i) {
+                cache.blocks[i] = blocks[i];
+            }
+            cache.count = count;
+        }
+    }
+
+    // Return the top count cached blocks to the pool, or to free() for
+    // blocks that came from the malloc fallback
+    template <size_t Class>
+    static void drain(SizeClassPool& self, size_t count) {
+        auto& pool = std::get<Class>(self.pools);
+        BlockCache& cache = self.caches[Class];
+        using BlockPtr = Block<sizeClassBytes[Class]>*;
+        BlockPtr owned[cacheCapacity];
+        size_t ownedCount = 0;
+        for (size_t i = cache.count - count; i < cache.count; ++i) {
+            BlockPtr block = static_cast<BlockPtr>(cache.blocks[i]);
+            if (pool.owns(block)) {
+                owned[ownedCount++] = block;
+            } else {
+                std::free(block);
+            }
+        }
+        pool.deallocateN(owned, ownedCount);
+        cache.count -= count;
+    }
+
+    template <size_t Class>
+    static size_t availableIn(const SizeClassPool& self) {
+        return std::get<Class>(self.pools).getAvailableSlots();
+    }
+
+    template <size_t... Classes>
+    static constexpr auto makeRefillFns(std::index_sequence<Classes...>) {
+        return std::array<void (*)(SizeClassPool&), classCount>{&refill<Classes>...};
+    }
+
+    template <size_t... Classes>
+    static constexpr auto makeDrainFns(std::index_sequence<Classes...>) {
+        return std::array<void (*)(SizeClassPool&, size_t), classCount>{&drain<Classes>...};
+    }
+
+    template <size_t... Classes>
+    static constexpr auto makeAvailableFns(std::index_sequence<Classes...>) {
+        return std::array<size_t (*)(const SizeClassPool&), classCount>{&availableIn<Classes>...};
+    }
+
+    static constexpr auto refillFns = makeRefillFns(std::make_index_sequence<classCount>());
+    static constexpr auto drainFns = makeDrainFns(std::make_index_sequence<classCount>());
+    static constexpr auto availableFns = makeAvailableFns(std::make_index_sequence<classCount>());
+
+    BlockCache caches[classCount];
+    Pools pools;
+};
@@ -0,0 +1,173 @@
+#pragma once
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+
+// Field type and owning class of a pointer to data member
+template <typename>
+struct SoAMemberTraits;
+
+template <typename Class, typename Field>
+struct SoAMemberTraits<Field Class::*> {
+    using ClassType = Class;
+    using FieldType = Field;
+};
+
+// Pool that stores selected members of an aggregate T in separate
+// contiguous arrays (structure of arrays) instead of whole objects:
+//
+//   struct Order { int id; double price; double quantity; };
+//   SoAMemoryPool<Order, &Order::price, &Order::quantity> orders(1 << 20);
+//
+// Slots are identified by index. column<&Order::price>() is a plain double
+// array, so a loop over one or two fields reads only those fields and can
+// be vectorized. Slots that are not live read as zero, so reductions can
+// run over whole columns; liveMask() has one bit per slot for masked
+// loops, and forEachLiveRun() hands out maximal runs of live slots.
+// Columns are cache-line aligned and padded to a multiple of 64 slots, so
+// whole mask words map to whole vectors. Allocation reuses the lowest free
+// slot, keeping live slots dense and runs long.
+template <typename T, auto... Members>
+class SoAMemoryPool {
+    static_assert(sizeof...(Members) > 0, "SoAMemoryPool needs at least one member");
+    static_assert((std::is_same_v<typename SoAMemberTraits<decltype(Members)>::ClassType, T> && ...),
+                  "Every member must be a data member of T");
+    static_assert((std::is_trivially_copyable_v<typename SoAMemberTraits<decltype(Members)>::FieldType> && ...),
+                  "Stored members must be trivially copyable");
+
+public:
+    template <auto Member>
+    using FieldType = typename SoAMemberTraits<decltype(Member)>::FieldType;
+
+    // Returned by allocate() when the pool is full
+    static constexpr size_t invalidSlot = SIZE_MAX;
+
+    // Reference to one slot; reads and writes go straight to the columns
+    class Ref {
+    public:
+        Ref(SoAMemoryPool* pool, size_t slot) : pool(pool), slot(slot) {}
+
+        template <auto Member>
+        FieldType<Member>& get() const { return pool->template column<Member>()[slot]; }
+
+        // Gather the stored members into a T; other members are value-initialized
+        operator T() const { return pool->load(slot); }
+
+        Ref& operator=(const T& value) {
+            pool->store(slot, value);
+            return *this;
+        }
+
+        size_t index() const { return slot; }
+
+    private:
+        SoAMemoryPool* pool;
+        size_t slot;
+    };
+
+    // Constructor: allocates one zeroed, cache-line aligned array per member
+    explicit SoAMemoryPool(size_t poolSize);
+
+    // Destructor: deallocates the columns
+    ~SoAMemoryPool();
+
+    SoAMemoryPool(const SoAMemoryPool&) = delete;
+    SoAMemoryPool& operator=(const SoAMemoryPool&) = delete;
+
+    // Allocate the lowest free slot; returns invalidSlot when full
+    size_t allocate();
+
+    // Allocate a slot and scatter the stored members of value into it
+    size_t create(const T& value);
+
+    // Return a slot to the pool and zero its fields; throws
+    // std::invalid_argument for a slot that is out of range or not allocated
+    void deallocate(size_t slot);
+
+    // Proxy for a slot
+    Ref operator[](size_t slot) { return Ref(this, slot); }
+
+    // Gather / scatter the stored members of one slot
+    T load(size_t slot) const;
+    void store(size_t slot, const T& value);
+
+    // Contiguous array holding one member for every slot
+    template <auto Member>
+    FieldType<Member>* column() { return std::get<columnIndex<Member>()>(columns); }
+
+    template <auto Member>
+    const FieldType<Member>* column() const { return std::get<columnIndex<Member>()>(columns); }
+
+    // One bit per slot, set when the slot is allocated; getMaskWords() words
+    const uint64_t* liveMask() const { return liveBits; }
+    size_t getMaskWords() const { return maskWords; }
+
+    // Call f(first, last) for every maximal run [first, last) of live slots,
+    // in ascending order
+    template <typename F>
+    void forEachLiveRun(F&& f) const;
+
+    // Call f(slot) for every live slot in ascending order
+    template <typename F>
+    void forEachLive(F&& f) const;
+
+    // Check whether a slot is allocated
+    bool isLive(size_t slot) const {
+        return slot < poolSize && (liveBits[slot / 64] >> (slot % 64) & 1) != 0;
+    }
+
+    // Get the total pool size
+    size_t getPoolSize() const { return poolSize; }
+
+    // Get the number of available slots
+    size_t getAvailableSlots() const { return availableSlots; }
+
+    // Check if pool is full
+    bool isFull() const { return availableSlots == 0; }
+
+    // Check if pool is empty
+    bool isEmpty() const { return availableSlots == poolSize; }
+
+private:
+    template <auto A, auto B>
+    static constexpr bool sameMember() {
+        if constexpr (std::is_same_v<decltype(A), decltype(B)>) {
+            return A == B;
+        } else {
+            return false;
+        }
+    }
+
+    // Position of Member in the Members pack
+    template <auto Member>
+    static constexpr size_t columnIndex() {
+        size_t index = 0;
+        size_t found = sizeof...(Members);
+        ((sameMember<Member, Members>() && found == sizeof...(Members) ? (found = index, ++index) : ++index), ...);
+        static_assert(((sameMember<Member, Members>()) || ...), "Member is not stored in this pool");
+        return found;
+    }
+
+    static constexpr size_t columnAlign = 64;
+
+    // Bytes in a column: whole mask words of slots, rounded to a cache line
+    template <auto Member>
+    size_t columnBytes() const {
+        return (maskWords * 64 * sizeof(FieldType<Member>) + columnAlign - 1) & ~(columnAlign - 1);
+    }
+
+    std::tuple<FieldType<Members>*...> columns;     // One array per stored member
+    uint64_t* liveBits;         // One bit per allocated slot
+    size_t poolSize;            // Total number of slots
+    size_t maskWords;           // Words in liveBits; columns hold maskWords * 64 slots
+    size_t availableSlots;      // Number of available slots
+    size_t firstFreeWord;       // No liveBits word below this has a free slot
+};
+
+#include "SoAMemoryPool.hpp"
@@ -0,0 +1,139 @@
+#pragma once
+
+template <typename T, auto... Members>
+SoAMemoryPool<T, Members...>::SoAMemoryPool(size_t poolSize)
+    : columns(), liveBits(nullptr), poolSize(poolSize), maskWords((poolSize + 63) / 64),
+      availableSlots(poolSize), firstFreeWord(0) {
+
+    if (poolSize == 0 || poolSize == invalidSlot) {
+        throw std::invalid_argument("Pool size must be greater than 0");
+    }
+
+    // Columns start zeroed and freed slots are zeroed again, so slots that
+    // are not live always read as zero
+    bool allocated = true;
+    ((std::get<columnIndex<Members>()>(columns) = static_cast<FieldType<Members>*>(
+          std::aligned_alloc(columnAlign, columnBytes<Members>())),
+      allocated &= std::get<columnIndex<Members>()>(columns) != nullptr), ...);
+    liveBits = static_cast<uint64_t*>(std::calloc(maskWords, sizeof(uint64_t)));
+
+    if (!allocated || liveBits == nullptr) {
+        std::apply([](auto*... column) { (std::free(column), ...); }, columns);
+        std::free(liveBits);
+        throw std::bad_alloc();
+    }
+    ((std::memset(static_cast<void*>(std::get<columnIndex<Members>()>(columns)), 0, columnBytes<Members>())), ...);
+}
+
+template <typename T, auto... Members>
+SoAMemoryPool<T, Members...>::~SoAMemoryPool() {
+    std::apply([](auto*... column) { (std::free(column), ...); }, columns);
+    std::free(liveBits);
+}
+
+template <typename T, auto... Members>
+size_t SoAMemoryPool<T, Members...>::allocate() {
+    if (availableSlots == 0) {
+        return invalidSlot; // Pool is full
+    }
+
+    // Lowest clear bit at or after the first word with room. Padding slots
+    // past poolSize are never reached while a real slot is free.
+    while (liveBits[firstFreeWord] == ~uint64_t{0}) {
+        firstFreeWord++;
+    }
+    uint64_t word = liveBits[firstFreeWord];
+    size_t slot = firstFreeWord * 64 + static_cast<size_t>(std::countr_one(word));
+    liveBits[firstFreeWord] = word | (word + 1);
+    availableSlots--;
+    return slot;
+}
+
+template <typename T, auto... Members>
+size_t SoAMemoryPool<T, Members...>::create(const T& value) {
+    size_t slot = allocate();
+    if (slot != invalidSlot) {
+        store(slot, value);
+    }
+    return slot;
+}
+
+template <typename T, auto... Members>
+void SoAMemoryPool<T, Members...>::deallocate(size_t slot) {
+    if (!isLive(slot)) {
+        throw std::invalid_argument("Slot is not allocated from this memory pool");
+    }
+
+    ((std::memset(static_cast<void*>(&column<Members>()[slot]), 0, sizeof(FieldType<Members>))), ...);
+    liveBits[slot / 64] &= ~(uint64_t{1} << (slot % 64));
+    if (slot / 64 < firstFreeWord) {
+        firstFreeWord = slot / 64;
+    }
+    availableSlots++;
+}
+
+template <typename T, auto... Members>
+T SoAMemoryPool<T, Members...>::load(size_t slot) const {
+    T value{};
+    ((value.*Members = column<Members>()[slot]), ...);
+    return value;
+}
+
+template <typename T, auto... Members>
+void SoAMemoryPool<T, Members...>::store(size_t slot, const T& value) {
+    ((column<Members>()[slot] = value.*Members), ...);
+}
+
+template <typename T, auto... Members>
+template <typename F>
+void SoAMemoryPool<T, Members...>::forEachLiveRun(F&& f) const {
+    size_t runStart = 0;
+    bool inRun = false;
+    for (size_t w = 0; w < maskWords; ++w) {
+        uint64_t word = liveBits[w];
+
+        // Whole words extend or break the current run without a bit scan
+        if (word == ~uint64_t{0}) {
+            if (!inRun) {
+                runStart = w * 64;
+                inRun = true;
+            }
+            continue;
+        }
+        size_t bit = 0;
+        while (bit < 64) {
+            uint64_t rest = word >> bit;
+            if (inRun) {
+                size_t ones = static_cast<size_t>(std::countr_one(rest));
+                if (bit + ones >= 64) {
+                    break;
+                }
+                f(runStart, w * 64 + bit + ones);
+                inRun = false;
+                bit += ones;
+            } else {
+                if (rest == 0) {
+                    break;
+                }
+                bit += static_cast<size_t>(std::countr_zero(rest));
+                runStart = w * 64 + bit;
+                inRun = true;
+            }
+        }
+    }
+    if (inRun) {
+        f(runStart, poolSize);
+    }
+}
+
+template <typename T, auto... Members>
+template <typename F>
+void SoAMemoryPool<T, Members...>::forEachLive(F&& f) const {
+    for (size_t w = 0; w < maskWords; ++w) {
+        uint64_t word = liveBits[w];
+        while (word != 0) {
+            f(w * 64 + static_cast<size_t>(std::countr_zero(word)));
+            word &= word - 1;
+        }
+    }
+}
@@ -0,0 +1,95 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+// Smallest unsigned integer type able to hold the value N
+template <size_t N>
+using SmallestIndexType = std::conditional_t<N <= UINT8_MAX, uint8_t,
+                          std::conditional_t<N <= UINT16_MAX, uint16_t,
+                          std::conditional_t<N <= UINT32_MAX, uint32_t, uint64_t>>>;
+
+// MemoryPool with a capacity fixed at compile time and no heap use at all.
+// The slab and free list live inline, so the pool can be a global, a local
+// or a member. The constexpr constructor zero-fills the slab and free list,
+// so a global pool is constant-initialized (and can be declared constinit)
+// with no run-time cost; slots are handed out behind a high-water mark, so
+// nothing else is written before first use.
+template <typename T, size_t N>
+class StaticMemoryPool {
+public:
+    static_assert(N > 0, "Pool size must be greater than 0");
+
+    using IndexType = SmallestIndexType<N>;
+
+    // Constructor: starts with every slot free
+    constexpr StaticMemoryPool() noexcept
+        : memoryPool{}, freeOffsets{}, availableSlots(N), nextFreeIndex(0), highWater(0) {}
+
+    StaticMemoryPool(const StaticMemoryPool&) = delete;
+    StaticMemoryPool& operator=(const StaticMemoryPool&) = delete;
+
+    // Allocate memory for an object of type T; returns nullptr when full
+    T* allocate();
+
+    // Free memory and return it to the pool
+    void deallocate(T* ptr);
+
+    // Allocate and construct an object in place; returns nullptr when full
+    template <typename... Args>
+    T* create(Args&&... args);
+
+    // Destroy an object made by create() and return its slot
+    void destroy(T* ptr);
+
+    // Call f(T*) for every allocated slot in ascending address order.
+    // Sorts the recycled-offset stack in place rather than using scratch
+    // memory, which only changes the order in which freed slots are reused.
+    template <typename F>
+    void forEachLive(F&& f);
+
+    // Return every slot to the pool at once without running destructors
+    constexpr void releaseAll() {
+        availableSlots = N;
+        nextFreeIndex = 0;
+        highWater = 0;
+    }
+
+    // Destroy every live object, then release all slots. Only valid when
+    // every allocated slot holds a constructed T; free for trivially
+    // destructible types.
+    void reset();
+
+    // Check whether a pointer lies inside this pool's slab
+    bool owns(const T* ptr) const {
+        return reinterpret_cast<uintptr_t>(ptr) - reinterpret_cast<uintptr_t>(memoryPool) < sizeof(memoryPool);
+    }
+
+    // Get the total pool size
+    static constexpr size_t getPoolSize() { return N; }
+
+    // Get the number of available slots
+    constexpr size_t getAvailableSlots() const { return availableSlots; }
+
+    // Check if pool is full
+    constexpr bool isFull() const { return availableSlots == 0; }
+
+    // Check if pool is empty
+    constexpr bool isEmpty() const { return availableSlots == N; }
+
+private:
+    // Size of each object
+    static constexpr size_t objectSize = sizeof(T);
+
+    alignas(T) unsigned char memoryPool[N * objectSize];   // Inline slab
+    IndexType freeOffsets[N];   // Stack of recycled offsets
+    IndexType availableSlots;   // Number of available slots
+    IndexType nextFreeIndex;    // Number of recycled offsets in freeOffsets array
+    IndexType highWater;        // Slots at or above this index were never used
+};
+
+#include "StaticMemoryPool.hpp"
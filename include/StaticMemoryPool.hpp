@@ -0,0 +1,86 @@
+#pragma once
+
+template <typename T, size_t N>
+T* StaticMemoryPool<T, N>::allocate() {
+    if (availableSlots == 0) {
+        return nullptr; // Pool is full
+    }
+
+    // Reuse the most recently freed slot, otherwise take a never-used one
+    size_t offset;
+    if (nextFreeIndex != 0) {
+        nextFreeIndex--;
+        offset = freeOffsets[nextFreeIndex];
+    } else {
+        offset = highWater++;
+    }
+    availableSlots--;
+
+    return reinterpret_cast<T*>(memoryPool + offset * objectSize);
+}
+
+template <typename T, size_t N>
+void StaticMemoryPool<T, N>::deallocate(T* ptr) {
+    if (ptr == nullptr) {
+        return;
+    }
+
+    // Validate that the pointer belongs to this pool
+    if (!owns(ptr)) {
+        throw std::invalid_argument("Pointer does not belong to this memory pool");
+    }
+
+    size_t offset = static_cast<size_t>(reinterpret_cast<unsigned char*>(ptr) - memoryPool) / objectSize;
+    freeOffsets[nextFreeIndex] = static_cast<IndexType>(offset);
+    nextFreeIndex++;
+    availableSlots++;
+}
+
+template <typename T, size_t N>
+template <typename... Args>
+T* StaticMemoryPool<T, N>::create(Args&&... args) {
+    T* slot = allocate();
+    if (slot == nullptr) {
+        return nullptr;
+    }
+
+    try {
+        return new (slot) T(std::forward<Args>(args)...);
+    } catch (...) {
+        deallocate(slot);
+        throw;
+    }
+}
+
+template <typename T, size_t N>
+void StaticMemoryPool<T, N>::destroy(T* ptr) {
+    if (ptr == nullptr) {
+        return;
+    }
+
+    ptr->~T();
+    deallocate(ptr);
+}
+
+template <typename T, size_t N>
+template <typename F>
+void StaticMemoryPool<T, N>::forEachLive(F&& f) {
+    // Live slots are those below the high-water mark that are not recycled
+    std::sort(freeOffsets, freeOffsets + nextFreeIndex);
+    size_t nextFree = 0;
+    for (size_t offset = 0; offset < highWater; ++offset) {
+        if (nextFree < nextFreeIndex && freeOffsets[nextFree] == offset) {
+            nextFree++;
+            continue;
+        }
+        f(reinterpret_cast<T*>(memoryPool + offset * objectSize));
+    }
+}
+
+template <typename T, size_t N>
+void StaticMemoryPool<T, N>::reset() {
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+        forEachLive([](T* obj) { obj->~T(); });
+    }
+    releaseAll();
+}
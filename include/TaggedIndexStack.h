@@ -0,0 +1,77 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// Lock-free LIFO stack of slot indices (a Treiber stack).
+// The head packs a 32-bit index with a 32-bit modification tag so that a
+// pop racing with a pop/push/pop of the same index (ABA) fails its CAS.
+// Links live in a caller-owned array of atomics, one per slot, so that a
+// stale read of a link never touches object memory.
+// The struct is standard layout and holds no pointers, which lets it live
+// inside memory shared between processes.
+struct TaggedIndexStack {
+    static constexpr uint32_t nullIndex = UINT32_MAX;
+
+    std::atomic<uint64_t> head{pack(nullIndex, 0)};
+
+    static constexpr uint64_t pack(uint32_t index, uint32_t tag) {
+        return (static_cast<uint64_t>(tag) << 32) | index;
+    }
+
+    static constexpr uint32_t indexOf(uint64_t word) {
+        return static_cast<uint32_t>(word);
+    }
+
+    static constexpr uint32_t tagOf(uint64_t word) {
+        return static_cast<uint32_t>(word >> 32);
+    }
+
+    // Reset to a stack holding [0, count) with 0 on top; not thread-safe
+    void initialize(std::atomic<uint32_t>* links, uint32_t count) {
+        for (uint32_t i = 0; i < count; ++i) {
+            links[i].store(i + 1 < count ? i + 1 : nullIndex, std::memory_order_relaxed);
+        }
+        head.store(pack(count ? 0 : nullIndex, 0), std::memory_order_release);
+    }
+
+    // Pop the top index, or nullIndex when the stack is empty
+    uint32_t pop(std::atomic<uint32_t>* links) {
+        uint64_t current = head.load(std::memory_order_acquire);
+        for (;;) {
+            uint32_t index = indexOf(current);
+            if (index == nullIndex) {
+                return nullIndex;
+            }
+            uint32_t next = links[index].load(std::memory_order_relaxed);
+            uint64_t desired = pack(next, tagOf(current) + 1);
+            if (head.compare_exchange_weak(current, desired,
+                                           std::memory_order_acquire,
+                                           std::memory_order_acquire)) {
+                return index;
+            }
+        }
+    }
+
+    // Push a single index
+    void push(std::atomic<uint32_t>* links, uint32_t index) {
+        pushChain(links, index, index);
+    }
+
+    // Push a pre-linked chain first -> ... -> last in one CAS
+    void pushChain(std::atomic<uint32_t>* links, uint32_t first, uint32_t last) {
+        uint64_t current = head.load(std::memory_order_relaxed);
+        for (;;) {
+            links[last].store(indexOf(current), std::memory_order_relaxed);
+            uint64_t desired = pack(first, tagOf(current) + 1);
+            if (head.compare_exchange_weak(current, desired,
+                                           std::memory_order_release,
+                                           std::memory_order_relaxed)) {
+                return;
+            }
+        }
+    }
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free,
+              "TaggedIndexStack requires lock-free 64-bit atomics");
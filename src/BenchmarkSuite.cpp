@@ -0,0 +1,658 @@
+#include "MemoryPool.h"
+#include "ConcurrentMemoryPool.h"
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory_resource>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+// Benchmark suite: per-operation latency percentiles for MemoryPool and
+// reference allocators across several allocation patterns.
+//
+//   benchmark_suite [--ops N] [--warmup N] [--seed N] [--cpu N]
+//                   [--workload NAME] [--csv FILE] [--json FILE]
+//
+// Every allocate and deallocate is timed on its own with the time-stamp
+// counter, minus the calibrated cost of reading it. Runs use fixed seeds,
+// so repeated runs see the same operation sequence, and on Linux they are
+// pinned to one CPU (two for producer/consumer). To compare against
+// jemalloc or another malloc replacement, run the suite with it in
+// LD_PRELOAD; the malloc rows are labelled with the preloaded library.
+
+// Object allocated by every workload
+struct BenchObject {
+    int id;
+    double value;
+    char data[48];
+};
+
+// Reads a monotonically increasing tick counter: the TSC where available,
+// otherwise steady_clock nanoseconds. The fences keep the timed operation
+// from being reordered around the reads.
+inline uint64_t readTicks() {
+#if defined(__x86_64__) || defined(__i386__)
+    _mm_lfence();
+    uint64_t ticks = __rdtsc();
+    _mm_lfence();
+    return ticks;
+#else
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+struct TickCalibration {
+    double ticksPerNs = 1.0;    // Tick frequency measured against steady_clock
+    uint64_t overhead = 0;      // Ticks spent by a back-to-back pair of reads
+};
+
+TickCalibration calibrateTicks() {
+    TickCalibration result;
+
+    auto wallStart = std::chrono::steady_clock::now();
+    uint64_t tickStart = readTicks();
+    while (std::chrono::steady_clock::now() - wallStart < std::chrono::milliseconds(100)) {
+    }
+    uint64_t tickEnd = readTicks();
+    double elapsedNs = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - wallStart).count());
+    result.ticksPerNs = static_cast<double>(tickEnd - tickStart) / elapsedNs;
+
+    // The minimum is the cost of the measurement itself
+    uint64_t overhead = UINT64_MAX;
+    for (int i = 0; i < 100000; ++i) {
+        uint64_t start = readTicks();
+        uint64_t end = readTicks();
+        overhead = std::min(overhead, end - start);
+    }
+    result.overhead = overhead;
+    return result;
+}
+
+// Log-linear histogram in the style of HdrHistogram: values below 64 get a
+// bucket each, larger values 32 buckets per power of two, so any recorded
+// value is reported within about 3% using a fixed 15 KB of counters.
+class LatencyHistogram {
+public:
+    void record(uint64_t value) {
+        counts[bucketOf(value)]++;
+        total++;
+        sum += value;
+        maxValue = std::max(maxValue, value);
+    }
+
+    void merge(const LatencyHistogram& other) {
+        for (size_t i = 0; i < bucketCount; ++i) {
+            counts[i] += other.counts[i];
+        }
+        total += other.total;
+        sum += other.sum;
+        maxValue = std::max(maxValue, other.maxValue);
+    }
+
+    // Highest value in the bucket holding the given percentile
+    uint64_t percentile(double p) const {
+        if (total == 0) {
+            return 0;
+        }
+        uint64_t target = static_cast<uint64_t>(std::ceil(p / 100.0 * static_cast<double>(total)));
+        target = std::max<uint64_t>(target, 1);
+        uint64_t seen = 0;
+        for (size_t i = 0; i < bucketCount; ++i) {
+            seen += counts[i];
+            if (seen >= target) {
+                return std::min(bucketHigh(i), maxValue);
+            }
+        }
+        return maxValue;
+    }
+
+    uint64_t count() const { return total; }
+    uint64_t max() const { return maxValue; }
+    double mean() const { return total == 0 ? 0.0 : static_cast<double>(sum) / static_cast<double>(total); }
+
+private:
+    static constexpr unsigned subBucketBits = 5;
+    static constexpr size_t linearLimit = size_t{2} << subBucketBits;
+    static constexpr size_t bucketCount = linearLimit + (64 - subBucketBits - 1) * (size_t{1} << subBucketBits);
+
+    static size_t bucketOf(uint64_t value) {
+        if (value < linearLimit) {
+            return static_cast<size_t>(value);
+        }
+        unsigned shift = static_cast<unsigned>(std::bit_width(value)) - subBucketBits - 1;
+        size_t mantissa = static_cast<size_t>(value >> shift) - (size_t{1} << subBucketBits);
+        return linearLimit + (shift - 1) * (size_t{1} << subBucketBits) + mantissa;
+    }
+
+    static uint64_t bucketHigh(size_t bucket) {
+        if (bucket < linearLimit) {
+            return bucket;
+        }
+        size_t shift = (bucket - linearLimit) / (size_t{1} << subBucketBits) + 1;
+        uint64_t mantissa = (bucket - linearLimit) % (size_t{1} << subBucketBits) + (uint64_t{1} << subBucketBits);
+        return ((mantissa + 1) << shift) - 1;
+    }
+
+    uint64_t counts[bucketCount] = {};
+    uint64_t total = 0;
+    uint64_t sum = 0;
+    uint64_t maxValue = 0;
+};
+
+// Times one operation into a histogram when recording is on
+class OperationTimer {
+public:
+    OperationTimer(const TickCalibration& calibration, bool recording)
+        : overhead(calibration.overhead), recording(recording) {}
+
+    template <typename Operation>
+    decltype(auto) time(LatencyHistogram& histogram, Operation&& operation) {
+        uint64_t start = readTicks();
+        if constexpr (std::is_void_v<std::invoke_result_t<Operation>>) {
+            operation();
+            finish(histogram, start);
+        } else {
+            auto result = operation();
+            finish(histogram, start);
+            return result;
+        }
+    }
+
+private:
+    void finish(LatencyHistogram& histogram, uint64_t start) {
+        uint64_t elapsed = readTicks() - start;
+        if (recording) {
+            histogram.record(elapsed > overhead ? elapsed - overhead : 0);
+        }
+    }
+
+    uint64_t overhead;
+    bool recording;
+};
+
+// CPU affinity is only set through the Linux scheduler API; elsewhere
+// nothing is pinned and the report says so
+#if defined(__linux__)
+// CPUs this process may run on, in ascending order
+std::vector<int> allowedCpus() {
+    std::vector<int> cpus;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+        for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+            if (CPU_ISSET(cpu, &set)) {
+                cpus.push_back(cpu);
+            }
+        }
+    }
+    return cpus;
+}
+
+// Pin the calling thread; returns false if the CPU is unavailable
+bool pinToCpu(int cpu) {
+    if (cpu < 0) {
+        return false;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return sched_setaffinity(0, sizeof(set), &set) == 0;
+}
+#else
+std::vector<int> allowedCpus() {
+    return {};
+}
+
+bool pinToCpu(int) {
+    return false;
+}
+#endif
+
+// Allocators under test. Each hands out BenchObject-sized blocks.
+
+constexpr size_t poolCapacity = 1 << 16;
+
+template <typename Traits>
+struct PoolAllocatorUnderTest {
+    MemoryPool<BenchObject, Traits> pool{poolCapacity};
+
+    void* allocate() { return pool.allocate(); }
+    void deallocate(void* ptr) { pool.deallocate(static_cast<BenchObject*>(ptr)); }
+};
+
+struct ConcurrentPoolUnderTest {
+    ConcurrentMemoryPool<BenchObject> pool{poolCapacity};
+
+    void* allocate() { return pool.allocate(); }
+    void deallocate(void* ptr) { pool.deallocate(static_cast<BenchObject*>(ptr)); }
+};
+
+struct MallocUnderTest {
+    void* allocate() { return std::malloc(sizeof(BenchObject)); }
+    void deallocate(void* ptr) { std::free(ptr); }
+};
+
+template <typename Resource>
+struct PmrUnderTest {
+    Resource resource;
+
+    void* allocate() { return resource.allocate(sizeof(BenchObject), alignof(BenchObject)); }
+    void deallocate(void* ptr) { resource.deallocate(ptr, sizeof(BenchObject), alignof(BenchObject)); }
+};
+
+// Workloads. Each allocates and frees through the allocator under test,
+// leaves nothing allocated, and records into the alloc/free histograms.
+
+struct BenchConfig {
+    size_t ops = 1000000;       // Allocations per measured run
+    size_t warmup = 100000;     // Allocations per warm-up run
+    uint64_t seed = 42;         // Seed for every random choice
+    int cpu = -1;               // CPU to pin to; -1 for the first allowed CPU
+    std::string workload;       // Only run this workload when set
+    std::string csvPath;
+    std::string jsonPath;
+};
+
+struct Histograms {
+    LatencyHistogram allocate;
+    LatencyHistogram deallocate;
+};
+
+inline void touch(void* ptr, size_t i) {
+    static_cast<BenchObject*>(ptr)->id = static_cast<int>(i);
+}
+
+// Remove a random element by swapping it with the last one
+inline void* takeRandom(std::vector<void*>& live, std::mt19937_64& gen) {
+    size_t index = std::uniform_int_distribution<size_t>(0, live.size() - 1)(gen);
+    void* ptr = live[index];
+    live[index] = live.back();
+    live.pop_back();
+    return ptr;
+}
+
+// Steady state: a live set of about ten thousand objects where each step
+// frees a random object or allocates a new one with equal probability
+template <typename Allocator>
+void runSteadyChurn(Allocator& allocator, size_t ops, uint64_t seed, OperationTimer& timer, Histograms& out) {
+    const size_t targetLive = 10000;
+    std::mt19937_64 gen(seed);
+    std::bernoulli_distribution coin(0.5);
+    std::vector<void*> live;
+    live.reserve(targetLive * 2);
+
+    for (size_t i = 0; i < targetLive; ++i) {
+        live.push_back(allocator.allocate());
+        touch(live.back(), i);
+    }
+    for (size_t allocated = 0; allocated < ops;) {
+        if ((coin(gen) || live.empty()) && live.size() < targetLive * 2) {
+            void* ptr = timer.time(out.allocate, [&] { return allocator.allocate(); });
+            touch(ptr, allocated++);
+            live.push_back(ptr);
+        } else {
+            void* ptr = takeRandom(live, gen);
+            timer.time(out.deallocate, [&] { allocator.deallocate(ptr); });
+        }
+    }
+    for (void* ptr : live) {
+        allocator.deallocate(ptr);
+    }
+}
+
+// Bursts: allocate a thousand objects back to back, then free them all in
+// a shuffled order
+template <typename Allocator>
+void runBurst(Allocator& allocator, size_t ops, uint64_t seed, OperationTimer& timer, Histograms& out) {
+    const size_t burstSize = 1000;
+    std::mt19937_64 gen(seed);
+    std::vector<void*> burst(burstSize);
+
+    for (size_t allocated = 0; allocated < ops; allocated += burstSize) {
+        for (size_t i = 0; i < burstSize; ++i) {
+            burst[i] = timer.time(out.allocate, [&] { return allocator.allocate(); });
+            touch(burst[i], i);
+        }
+        std::shuffle(burst.begin(), burst.end(), gen);
+        for (void* ptr : burst) {
+            timer.time(out.deallocate, [&] { allocator.deallocate(ptr); });
+        }
+    }
+}
+
+// Random lifetimes: one allocation per step, each freed after an
+// exponentially distributed number of steps (mean 100), via a timing wheel
+template <typename Allocator>
+void runRandomLifetime(Allocator& allocator, size_t ops, uint64_t seed, OperationTimer& timer, Histograms& out) {
+    const size_t wheelSize = 1024;
+    std::mt19937_64 gen(seed);
+    std::exponential_distribution<double> lifetime(1.0 / 100.0);
+    std::vector<std::vector<void*>> wheel(wheelSize);
+
+    for (size_t step = 0; step < ops + wheelSize; ++step) {
+        std::vector<void*>& expiring = wheel[step % wheelSize];
+        for (void* ptr : expiring) {
+            timer.time(out.deallocate, [&] { allocator.deallocate(ptr); });
+        }
+        expiring.clear();
+        if (step >= ops) {
+            continue;
+        }
+
+        void* ptr = timer.time(out.allocate, [&] { return allocator.allocate(); });
+        touch(ptr, step);
+        size_t steps = std::min<size_t>(static_cast<size_t>(lifetime(gen)) + 1, wheelSize - 1);
+        wheel[(step + steps) % wheelSize].push_back(ptr);
+    }
+}
+
+// Single-producer single-consumer ring used to pass objects between threads
+class HandoffRing {
+public:
+    bool push(void* ptr) {
+        size_t tail = tailIndex.load(std::memory_order_relaxed);
+        if (tail - headIndex.load(std::memory_order_acquire) == capacity) {
+            return false;
+        }
+        slots[tail % capacity] = ptr;
+        tailIndex.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    void* pop() {
+        size_t head = headIndex.load(std::memory_order_relaxed);
+        if (head == tailIndex.load(std::memory_order_acquire)) {
+            return nullptr;
+        }
+        void* ptr = slots[head % capacity];
+        headIndex.store(head + 1, std::memory_order_release);
+        return ptr;
+    }
+
+private:
+    static constexpr size_t capacity = 1024;
+    void* slots[capacity];
+    alignas(64) std::atomic<size_t> headIndex{0};
+    alignas(64) std::atomic<size_t> tailIndex{0};
+};
+
+// Producer/consumer: one thread allocates and hands objects over, another
+// frees them, so every free is of memory allocated on a different thread
+template <typename Allocator>
+void runProducerConsumer(Allocator& allocator, size_t ops, int producerCpu, int consumerCpu,
+                         OperationTimer& timer, Histograms& out) {
+    HandoffRing ring;
+    LatencyHistogram consumerHistogram;
+    OperationTimer consumerTimer = timer;
+
+    std::thread consumer([&] {
+        pinToCpu(consumerCpu);
+        for (size_t freed = 0; freed < ops;) {
+            void* ptr = ring.pop();
+            if (ptr == nullptr) {
+                std::this_thread::yield();
+                continue;
+            }
+            consumerTimer.time(consumerHistogram, [&] { allocator.deallocate(ptr); });
+            freed++;
+        }
+    });
+
+    pinToCpu(producerCpu);
+    for (size_t i = 0; i < ops; ++i) {
+        void* ptr = timer.time(out.allocate, [&] { return allocator.allocate(); });
+        touch(ptr, i);
+        while (!ring.push(ptr)) {
+            std::this_thread::yield();
+        }
+    }
+    consumer.join();
+    out.deallocate.merge(consumerHistogram);
+}
+
+struct BenchResult {
+    std::string workload;
+    std::string allocator;
+    std::string operation;
+    const LatencyHistogram* histogram;
+};
+
+class BenchmarkSuite {
+public:
+    explicit BenchmarkSuite(const BenchConfig& config) : config(config), calibration(calibrateTicks()) {
+        std::vector<int> cpus = allowedCpus();
+        primaryCpu = config.cpu >= 0 ? config.cpu : (cpus.empty() ? -1 : cpus.front());
+        secondaryCpu = primaryCpu;
+        for (int cpu : cpus) {
+            if (cpu != primaryCpu) {
+                secondaryCpu = cpu;
+                break;
+            }
+        }
+        pinned = pinToCpu(primaryCpu);
+
+        const char* preload = std::getenv("LD_PRELOAD");
+        mallocLabel = preload != nullptr && *preload != '\0' ? std::string("malloc (") + preload + ")" : "malloc";
+    }
+
+    void run() {
+        std::cout << "MemoryPool Benchmark Suite" << std::endl;
+        std::cout << "==========================" << std::endl;
+        std::cout << std::fixed << std::setprecision(3);
+        std::cout << "Tick rate: " << calibration.ticksPerNs << " ticks/ns, timer overhead "
+                  << calibration.overhead << " ticks (subtracted)" << std::endl;
+        std::cout << "Pinned to CPU " << (pinned ? std::to_string(primaryCpu) : std::string("none"))
+                  << ", seed " << config.seed << ", " << config.ops << " allocations per run, "
+                  << config.warmup << " warm-up" << std::endl;
+
+        runSingleThreaded("steady-churn", [](auto& allocator, size_t ops, uint64_t seed, OperationTimer& timer, Histograms& out) {
+            runSteadyChurn(allocator, ops, seed, timer, out);
+        });
+        runSingleThreaded("burst", [](auto& allocator, size_t ops, uint64_t seed, OperationTimer& timer, Histograms& out) {
+            runBurst(allocator, ops, seed, timer, out);
+        });
+        runSingleThreaded("random-lifetime", [](auto& allocator, size_t ops, uint64_t seed, OperationTimer& timer, Histograms& out) {
+            runRandomLifetime(allocator, ops, seed, timer, out);
+        });
+        runThreaded("producer-consumer");
+
+        if (!config.csvPath.empty()) {
+            writeCsv(config.csvPath);
+        }
+        if (!config.jsonPath.empty()) {
+            writeJson(config.jsonPath);
+        }
+    }
+
+private:
+    bool selected(const char* workload) const {
+        return config.workload.empty() || config.workload == workload;
+    }
+
+    template <typename Allocator, typename Workload>
+    void measure(const char* workload, const std::string& allocatorName, Workload&& body) {
+        Allocator allocator;
+
+        // Warm caches, TLB entries and the allocator's own free lists first
+        OperationTimer warmupTimer(calibration, false);
+        Histograms discarded;
+        body(allocator, config.warmup, config.seed + 1, warmupTimer, discarded);
+
+        OperationTimer timer(calibration, true);
+        histograms.push_back(std::make_unique<Histograms>());
+        body(allocator, config.ops, config.seed, timer, *histograms.back());
+
+        results.push_back({workload, allocatorName, "allocate", &histograms.back()->allocate});
+        results.push_back({workload, allocatorName, "deallocate", &histograms.back()->deallocate});
+        printRow(results[results.size() - 2]);
+        printRow(results.back());
+    }
+
+    template <typename Workload>
+    void runSingleThreaded(const char* workload, Workload&& body) {
+        if (!selected(workload)) {
+            return;
+        }
+        printHeader(workload);
+        measure<PoolAllocatorUnderTest<DefaultPoolTraits>>(workload, "MemoryPool", body);
+        measure<PoolAllocatorUnderTest<IntrusivePoolTraits>>(workload, "MemoryPool<Intrusive>", body);
+        measure<MallocUnderTest>(workload, mallocLabel, body);
+        measure<PmrUnderTest<std::pmr::unsynchronized_pool_resource>>(workload, "pmr::unsynchronized_pool", body);
+    }
+
+    void runThreaded(const char* workload) {
+        if (!selected(workload)) {
+            return;
+        }
+        printHeader(workload);
+        auto body = [this](auto& allocator, size_t ops, uint64_t, OperationTimer& timer, Histograms& out) {
+            runProducerConsumer(allocator, ops, primaryCpu, secondaryCpu, timer, out);
+        };
+        measure<ConcurrentPoolUnderTest>(workload, "ConcurrentMemoryPool", body);
+        measure<MallocUnderTest>(workload, mallocLabel, body);
+        measure<PmrUnderTest<std::pmr::synchronized_pool_resource>>(workload, "pmr::synchronized_pool", body);
+        pinToCpu(primaryCpu);
+    }
+
+    double toNs(double ticks) const { return ticks / calibration.ticksPerNs; }
+
+    void printHeader(const char* workload) const {
+        std::cout << "\n=== " << workload << " (ns) ===" << std::endl;
+        std::cout << std::left << std::setw(28) << "allocator" << std::setw(12) << "operation" << std::right
+                  << std::setw(10) << "mean" << std::setw(10) << "p50" << std::setw(10) << "p90"
+                  << std::setw(10) << "p99" << std::setw(10) << "p99.9" << std::setw(12) << "max" << std::endl;
+    }
+
+    void printRow(const BenchResult& result) const {
+        const LatencyHistogram& h = *result.histogram;
+        std::cout << std::fixed << std::setprecision(1);
+        std::cout << std::left << std::setw(28) << result.allocator << std::setw(12) << result.operation << std::right
+                  << std::setw(10) << toNs(h.mean())
+                  << std::setw(10) << toNs(static_cast<double>(h.percentile(50)))
+                  << std::setw(10) << toNs(static_cast<double>(h.percentile(90)))
+                  << std::setw(10) << toNs(static_cast<double>(h.percentile(99)))
+                  << std::setw(10) << toNs(static_cast<double>(h.percentile(99.9)))
+                  << std::setw(12) << toNs(static_cast<double>(h.max())) << std::endl;
+    }
+
+    void writeCsv(const std::string& path) const {
+        std::ofstream file(path);
+        file << "workload,allocator,operation,count,mean_ns,p50_ns,p90_ns,p99_ns,p999_ns,max_ns\n";
+        file << std::fixed << std::setprecision(2);
+        for (const BenchResult& result : results) {
+            const LatencyHistogram& h = *result.histogram;
+            file << result.workload << ",\"" << result.allocator << "\"," << result.operation << ","
+                 << h.count() << "," << toNs(h.mean()) << ","
+                 << toNs(static_cast<double>(h.percentile(50))) << ","
+                 << toNs(static_cast<double>(h.percentile(90))) << ","
+                 << toNs(static_cast<double>(h.percentile(99))) << ","
+                 << toNs(static_cast<double>(h.percentile(99.9))) << ","
+                 << toNs(static_cast<double>(h.max())) << "\n";
+        }
+        std::cout << "\nWrote " << path << std::endl;
+    }
+
+    void writeJson(const std::string& path) const {
+        std::ofstream file(path);
+        file << std::fixed << std::setprecision(3);
+        file << "{\n  \"ticks_per_ns\": " << calibration.ticksPerNs
+             << ",\n  \"timer_overhead_ticks\": " << calibration.overhead
+             << ",\n  \"cpu\": " << (pinned ? primaryCpu : -1)
+             << ",\n  \"seed\": " << config.seed
+             << ",\n  \"ops\": " << config.ops
+             << ",\n  \"results\": [\n";
+        file << std::setprecision(2);
+        for (size_t i = 0; i < results.size(); ++i) {
+            const LatencyHistogram& h = *results[i].histogram;
+            file << "    {\"workload\": \"" << results[i].workload
+                 << "\", \"allocator\": \"" << results[i].allocator
+                 << "\", \"operation\": \"" << results[i].operation
+                 << "\", \"count\": " << h.count()
+                 << ", \"mean_ns\": " << toNs(h.mean())
+                 << ", \"p50_ns\": " << toNs(static_cast<double>(h.percentile(50)))
+                 << ", \"p90_ns\": " << toNs(static_cast<double>(h.percentile(90)))
+                 << ", \"p99_ns\": " << toNs(static_cast<double>(h.percentile(99)))
+                 << ", \"p999_ns\": " << toNs(static_cast<double>(h.percentile(99.9)))
+                 << ", \"max_ns\": " << toNs(static_cast<double>(h.max()))
+                 << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+        }
+        file << "  ]\n}\n";
+        std::cout << "Wrote " << path << std::endl;
+    }
+
+    BenchConfig config;
+    TickCalibration calibration;
+    int primaryCpu = -1;
+    int secondaryCpu = -1;
+    bool pinned = false;
+    std::string mallocLabel;
+    std::vector<std::unique_ptr<Histograms>> histograms;
+    std::vector<BenchResult> results;
+};
+
+int main(int argc, char** argv) {
+    BenchConfig config;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (i + 1 >= argc) {
+            std::cerr << "Missing value for " << arg << std::endl;
+            return 1;
+        }
+        std::string value = argv[++i];
+        try {
+            if (arg == "--ops") {
+                config.ops = std::stoull(value);
+            } else if (arg == "--warmup") {
+                config.warmup = std::stoull(value);
+            } else if (arg == "--seed") {
+                config.seed = std::stoull(value);
+            } else if (arg == "--cpu") {
+                config.cpu = std::stoi(value);
+            } else if (arg == "--workload") {
+                config.workload = value;
+            } else if (arg == "--csv") {
+                config.csvPath = value;
+            } else if (arg == "--json") {
+                config.jsonPath = value;
+            } else {
+                std::cerr << "Unknown option " << arg << std::endl;
+                return 1;
+            }
+        } catch (const std::logic_error&) {
+            // std::invalid_argument or std::out_of_range from a number
+            std::cerr << "Invalid value " << value << " for " << arg << std::endl;
+            return 1;
+        }
+    }
+
+    try {
+        BenchmarkSuite suite(config);
+        suite.run();
+    } catch (const std::exception& e) {
+        std::cerr << "Error during benchmarking: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
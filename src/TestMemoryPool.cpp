@@ -1,7 +1,26 @@
 #include "MemoryPool.h"
+#include "ConcurrentMemoryPool.h"
+#include "GrowableMemoryPool.h"
+#include "PoolPtr.h"
+#include "PoolAllocator.h"
+#include "SizeClassPool.h"
+#include "StaticMemoryPool.h"
+#include "SharedMemoryPool.h"
+#include "SoAMemoryPool.h"
+#include "CoroutineFramePool.h"
+#include "EpochMemoryPool.h"
 #include <iostream>
 #include <vector>
+#include <thread>
+#include <set>
+#include <string>
+#include <list>
+#include <map>
+#include <unordered_map>
 #include <cassert>
+#include <coroutine>
+#include <unistd.h>
+#include <sys/wait.h>
 
 // Example class to demonstrate MemoryPool usage
 class TestObject {
@@ -124,6 +143,1190 @@ void test_multiple_alloc_dealloc() {
     std::cout << "Multiple alloc/dealloc test passed." << std::endl;
 }
 
+void test_concurrent_pool() {
+    std::cout << "\n=== Concurrent Pool Test ===" << std::endl;
+    const size_t threadCount = 4;
+    const size_t perThread = 64;
+    ConcurrentMemoryPool<TestObject> pool(threadCount * perThread);
+
+    // Every thread repeatedly takes and returns a batch of slots, checking
+    // that nobody else wrote into a slot it currently owns
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < threadCount; ++t) {
+        threads.emplace_back([&pool, t]() {
+            std::vector<TestObject*> owned;
+            for (int round = 0; round < 200; ++round) {
+                for (size_t i = 0; i < perThread; ++i) {
+                    TestObject* obj = pool.allocate();
+                    assert(obj != nullptr);
+                    *obj = TestObject(static_cast<int>(t), static_cast<double>(i));
+                    owned.push_back(obj);
+                }
+                for (size_t i = 0; i < owned.size(); ++i) {
+                    assert(owned[i]->value == static_cast<int>(t));
+                    assert(owned[i]->data == static_cast<double>(i));
+                    pool.deallocate(owned[i]);
+                }
+                owned.clear();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    assert(pool.isEmpty());
+
+    // Draining the pool must hand out every slot exactly once
+    std::set<TestObject*> seen;
+    while (TestObject* obj = pool.allocate()) {
+        assert(seen.insert(obj).second);
+    }
+    assert(seen.size() == pool.getPoolSize());
+    assert(pool.isFull());
+    std::cout << "Concurrent pool test passed." << std::endl;
+}
+
+void test_growable_pool() {
+    std::cout << "\n=== Growable Pool Test ===" << std::endl;
+    GrowableMemoryPool<TestObject> pool(4);
+    const size_t slabSlots = pool.getSlotsPerSlab();
+    std::vector<TestObject*> objects;
+
+    // Allocating past one slab chains a new one instead of failing
+    for (size_t i = 0; i < slabSlots * 3; ++i) {
+        TestObject* obj = pool.allocate();
+        assert(obj != nullptr);
+        *obj = TestObject(static_cast<int>(i), i * 0.5);
+        objects.push_back(obj);
+    }
+    assert(pool.getSlabCount() == 3);
+    std::cout << "Slabs after " << objects.size() << " allocations: " << pool.getSlabCount() << std::endl;
+
+    for (size_t i = 0; i < objects.size(); ++i) {
+        assert(objects[i]->value == static_cast<int>(i));
+        pool.deallocate(objects[i]);
+    }
+    assert(pool.isEmpty());
+
+    // Fully free slabs are released on request
+    assert(pool.trim(1) == 2);
+    assert(pool.getSlabCount() == 1);
+    assert(pool.allocate() != nullptr);
+
+    // A pointer from another pool is rejected
+    GrowableMemoryPool<TestObject> otherPool(4);
+    TestObject* foreign = otherPool.allocate();
+    try {
+        pool.deallocate(foreign);
+        std::cout << "ERROR: Foreign deallocation did not throw!" << std::endl;
+    } catch (const std::invalid_argument& e) {
+        std::cout << "Caught expected exception: " << e.what() << std::endl;
+    }
+
+    // Heap and stack pointers are rejected without reading their surroundings
+    auto heapObject = std::make_unique<TestObject>();
+    TestObject stackObject;
+    for (TestObject* stray : {heapObject.get(), &stackObject}) {
+        bool threw = false;
+        try {
+            pool.deallocate(stray);
+        } catch (const std::invalid_argument&) {
+            threw = true;
+        }
+        assert(threw);
+    }
+
+    // Slots the slab never handed out are rejected too, so the counts stay intact
+    GrowableMemoryPool<TestObject> freshPool(4);
+    TestObject* first = freshPool.allocate();
+    bool threw = false;
+    try {
+        freshPool.deallocate(first + 1);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+    assert(freshPool.getAvailableSlots() == freshPool.getSlotsPerSlab() - 1);
+    freshPool.deallocate(first);
+    assert(freshPool.isEmpty());
+
+    // A growth limit restores the fixed-size behaviour
+    GrowableMemoryPool<TestObject> cappedPool(4, 1);
+    for (size_t i = 0; i < cappedPool.getSlotsPerSlab(); ++i) {
+        assert(cappedPool.allocate() != nullptr);
+    }
+    assert(cappedPool.allocate() == nullptr);
+    std::cout << "Growable pool test passed." << std::endl;
+}
+
+void test_intrusive_pool() {
+    std::cout << "\n=== Intrusive Free List Test ===" << std::endl;
+    MemoryPool<TestObject, IntrusivePoolTraits> pool(4);
+    std::vector<TestObject*> ptrs;
+
+    for (int i = 0; i < 4; ++i) {
+        TestObject* obj = pool.allocate();
+        assert(obj != nullptr);
+        *obj = TestObject(i, i * 1.25);
+        ptrs.push_back(obj);
+    }
+    assert(pool.isFull());
+    assert(pool.allocate() == nullptr);
+
+    // Freed slots are reused most-recently-freed first
+    pool.deallocate(ptrs[1]);
+    pool.deallocate(ptrs[3]);
+    assert(pool.allocate() == ptrs[3]);
+    assert(pool.allocate() == ptrs[1]);
+    for (int i = 0; i < 4; ++i) {
+        pool.deallocate(ptrs[i]);
+    }
+    assert(pool.isEmpty());
+
+    // Objects smaller than a link are padded to hold one
+    MemoryPool<char, IntrusivePoolTraits> bytePool(3);
+    char* a = bytePool.allocate();
+    char* b = bytePool.allocate();
+    assert(b - a == static_cast<std::ptrdiff_t>(sizeof(uint32_t)));
+    bytePool.deallocate(a);
+    bytePool.deallocate(b);
+    assert(bytePool.isEmpty());
+    std::cout << "Intrusive free list test passed." << std::endl;
+}
+
+void test_lazy_initialization() {
+    std::cout << "\n=== Lazy Initialization Test ===" << std::endl;
+    // A pool far larger than what is used costs only address space
+    const size_t poolSize = 1 << 24;
+    MemoryPool<TestObject, MmapPoolTraits> pool(poolSize);
+    assert(pool.getAvailableSlots() == poolSize);
+
+    // Never-used slots are handed out in address order
+    TestObject* first = pool.allocate();
+    TestObject* second = pool.allocate();
+    assert(second == first + 1);
+    *first = TestObject(1, 1.0);
+    *second = TestObject(2, 2.0);
+
+    // Recycled slots are preferred over fresh ones
+    pool.deallocate(first);
+    assert(pool.allocate() == first);
+    TestObject* third = pool.allocate();
+    assert(third == second + 1);
+
+    pool.deallocate(first);
+    pool.deallocate(second);
+    pool.deallocate(third);
+    assert(pool.isEmpty());
+    std::cout << "Lazy initialization test passed." << std::endl;
+}
+
+void test_backing_options() {
+    std::cout << "\n=== Backing Options Test ===" << std::endl;
+    MmapBacking backing;
+    backing.hugePages = true;   // Falls back to transparent huge pages if none are reserved
+    backing.populate = true;
+    MemoryPool<TestObject, MmapPoolTraits> pool(100000, backing);
+
+    std::vector<TestObject*> objects;
+    for (int i = 0; i < 1000; ++i) {
+        TestObject* obj = pool.allocate();
+        assert(obj != nullptr);
+        *obj = TestObject(i, i * 0.25);
+        objects.push_back(obj);
+    }
+    for (auto obj : objects) {
+        pool.deallocate(obj);
+    }
+    assert(pool.isEmpty());
+    std::cout << "Backing options test passed." << std::endl;
+}
+
+void test_cache_aligned_pool() {
+    std::cout << "\n=== Cache-Aligned Pool Test ===" << std::endl;
+    MemoryPool<TestObject, CacheAlignedPoolTraits> pool(8);
+
+    TestObject* first = pool.allocate();
+    TestObject* second = pool.allocate();
+    assert(reinterpret_cast<uintptr_t>(first) % cacheLineSize == 0);
+    assert(reinterpret_cast<uintptr_t>(second) % cacheLineSize == 0);
+    assert(reinterpret_cast<char*>(second) - reinterpret_cast<char*>(first) == static_cast<std::ptrdiff_t>(cacheLineSize));
+
+    // Counters are moved onto their own line
+    static_assert(alignof(MemoryPool<TestObject, CacheAlignedPoolTraits>) == cacheLineSize);
+
+    pool.deallocate(first);
+    pool.deallocate(second);
+    assert(pool.isEmpty());
+    std::cout << "Cache-aligned pool test passed." << std::endl;
+}
+
+void test_batch_operations() {
+    std::cout << "\n=== Batch Operations Test ===" << std::endl;
+    MemoryPool<TestObject> pool(16);
+    TestObject* batch[8];
+
+    assert(pool.allocateN(batch, 8));
+    assert(pool.getAvailableSlots() == 8);
+    for (int i = 0; i < 8; ++i) {
+        *batch[i] = TestObject(i, i * 0.5);
+    }
+
+    // Batches draw on recycled slots first, then fresh ones
+    pool.deallocateN(batch, 4);
+    TestObject* again[6];
+    assert(pool.allocateN(again, 6));
+    std::set<TestObject*> distinct(again, again + 6);
+    assert(distinct.size() == 6);
+    for (int i = 0; i < 4; ++i) {
+        assert(distinct.count(batch[i]) == 1);
+    }
+
+    // All or nothing when the pool cannot satisfy the request
+    TestObject* tooMany[8];
+    assert(!pool.allocateN(tooMany, 8));
+    assert(pool.getAvailableSlots() == 6);
+
+    // A batch containing a foreign pointer frees nothing
+    TestObject stackObj;
+    TestObject* mixed[2] = {again[0], &stackObj};
+    try {
+        pool.deallocateN(mixed, 2);
+        std::cout << "ERROR: Invalid batch deallocation did not throw!" << std::endl;
+    } catch (const std::invalid_argument& e) {
+        std::cout << "Caught expected exception: " << e.what() << std::endl;
+    }
+    assert(pool.getAvailableSlots() == 6);
+
+    pool.deallocateN(again, 6);
+    pool.deallocateN(batch + 4, 4);
+    assert(pool.isEmpty());
+
+    // Contiguous runs come from the never-used tail
+    TestObject* run = pool.allocateContiguous(4);
+    assert(run != nullptr);
+    assert(pool.allocateContiguous(16) == nullptr);
+    for (int i = 0; i < 4; ++i) {
+        pool.deallocate(run + i);
+    }
+    assert(pool.isEmpty());
+    std::cout << "Batch operations test passed." << std::endl;
+}
+
+// Non-trivial type that counts live instances
+struct TrackedObject {
+    static int liveCount;
+    std::string name;
+    int id;
+
+    TrackedObject(std::string n, int i) : name(std::move(n)), id(i) {
+        if (id < 0) {
+            throw std::invalid_argument("negative id");
+        }
+        ++liveCount;
+    }
+    ~TrackedObject() { --liveCount; }
+};
+int TrackedObject::liveCount = 0;
+
+MemoryPool<TrackedObject> globalTrackedPool(4);
+
+void test_object_lifetime() {
+    std::cout << "\n=== Object Lifetime Test ===" << std::endl;
+    MemoryPool<TrackedObject> pool(2);
+
+    // create() constructs in place, destroy() runs the destructor
+    TrackedObject* obj = pool.create("constructed in place", 1);
+    assert(obj != nullptr && obj->id == 1 && obj->name == "constructed in place");
+    assert(TrackedObject::liveCount == 1);
+    pool.destroy(obj);
+    assert(TrackedObject::liveCount == 0);
+    assert(pool.isEmpty());
+
+    // A throwing constructor gives its slot back
+    try {
+        pool.create("bad", -1);
+        std::cout << "ERROR: Throwing constructor did not propagate!" << std::endl;
+    } catch (const std::invalid_argument&) {
+        assert(pool.isEmpty());
+    }
+
+    // Owning handles destroy their object when they go out of scope
+    {
+        auto first = makePoolUnique(pool, "first", 2);
+        auto moved = std::move(first);
+        assert(!first && moved->id == 2);
+        auto second = makePoolUnique(pool, "second", 3);
+        assert(pool.isFull());
+        auto third = makePoolUnique(pool, "third", 4);
+        assert(!third);
+        assert(TrackedObject::liveCount == 2);
+    }
+    assert(TrackedObject::liveCount == 0);
+    assert(pool.isEmpty());
+
+    // Handles bound to a static pool carry no deleter state
+    {
+        auto handle = makeStaticPoolUnique<globalTrackedPool>("static", 5);
+        static_assert(sizeof(handle) == sizeof(TrackedObject*));
+        assert(handle->id == 5);
+    }
+    assert(globalTrackedPool.isEmpty());
+    std::cout << "Object lifetime test passed." << std::endl;
+}
+
+void test_container_allocators() {
+    std::cout << "\n=== Container Allocator Test ===" << std::endl;
+    DefaultPoolMemoryResource resource(64);
+
+    // Standard allocator interface, rebound to each container's node type
+    std::list<int, PoolAllocator<int>> numbers{PoolAllocator<int>(resource)};
+    for (int i = 0; i < 1000; ++i) {
+        numbers.push_back(i);
+    }
+    assert(numbers.size() == 1000 && numbers.back() == 999);
+
+    using MapAllocator = PoolAllocator<std::pair<const int, std::string>>;
+    std::map<int, std::string, std::less<int>, MapAllocator> names{MapAllocator(resource)};
+    names[2] = "two";
+    names[1] = "one";
+    assert(names.begin()->second == "one");
+
+    // std::pmr containers use the same pools through the memory_resource
+    std::pmr::unordered_map<int, int> squares(&resource);
+    for (int i = 0; i < 1000; ++i) {
+        squares[i] = i * i;
+    }
+    for (int i = 0; i < 1000; i += 2) {
+        squares.erase(i);
+    }
+    assert(squares.size() == 500 && squares.at(31) == 961);
+
+    numbers.clear();
+    names.clear();
+    squares.clear();
+    assert(PoolAllocator<int>(resource) == PoolAllocator<double>(resource));
+
+    // A small block the pools did not hand out goes back to upstream
+    PoolAllocator<int> allocator(resource);
+    void* upstreamBlock = resource.getUpstream()->allocate(sizeof(int), alignof(std::max_align_t));
+    allocator.deallocate(static_cast<int*>(upstreamBlock), 1);
+    std::cout << "Container allocator test passed." << std::endl;
+}
+
+void test_size_class_pool() {
+    std::cout << "\n=== Size Class Pool Test ===" << std::endl;
+    using Pool = SizeClassPool<>;
+    static_assert(Pool::classSize(Pool::classOf(1)) == 8);
+    static_assert(Pool::classSize(Pool::classOf(17)) == 32);
+    static_assert(Pool::classSize(Pool::classOf(129)) == 160);
+    static_assert(Pool::classSize(Pool::classOf(4096)) == 4096);
+
+    Pool pool(256);
+    const size_t sizeClass = Pool::classOf(100);
+    const size_t blocks = pool.getAvailableBlocks(sizeClass);
+    assert(blocks == 256 / Pool::classSize(sizeClass));
+
+    // Blocks of different sizes come from different classes and do not overlap
+    std::vector<std::pair<void*, size_t>> live;
+    for (size_t size : {1, 8, 24, 100, 100, 512, 3000, 5000}) {
+        void* block = pool.allocate(size);
+        assert(block != nullptr);
+        std::memset(block, static_cast<int>(size & 0xff), size);
+        live.emplace_back(block, size);
+    }
+    assert(pool.getAvailableBlocks(sizeClass) == blocks - 2);
+    for (auto& [block, size] : live) {
+        assert(static_cast<unsigned char*>(block)[size - 1] == (size & 0xff));
+    }
+
+    // An exhausted class falls back to malloc transparently
+    std::vector<void*> overflow;
+    for (size_t i = 0; i < blocks + 4; ++i) {
+        overflow.push_back(pool.allocate(100));
+        assert(overflow.back() != nullptr);
+    }
+    assert(pool.getAvailableBlocks(sizeClass) == 0);
+    for (void* block : overflow) {
+        pool.deallocate(block, 100);
+    }
+    for (auto& [block, size] : live) {
+        pool.deallocate(block, size);
+    }
+    assert(pool.getAvailableBlocks(sizeClass) >= blocks);
+
+    // Many frees of one class spill from the front cache back into the pool
+    std::vector<void*> many;
+    for (size_t i = 0; i < 200; ++i) {
+        many.push_back(pool.allocate(8));
+    }
+    for (void* block : many) {
+        pool.deallocate(block, 8);
+    }
+    assert(pool.getAvailableBlocks(Pool::classOf(8)) >= 256 / 8);
+    std::cout << "Size class pool test passed." << std::endl;
+}
+
+// constinit fails to compile unless the constructor is a constant expression
+constinit StaticMemoryPool<TrackedObject, 4> globalStaticPool;
+
+void test_static_pool() {
+    std::cout << "\n=== Static Pool Test ===" << std::endl;
+    static_assert(std::is_same_v<StaticMemoryPool<TestObject, 255>::IndexType, uint8_t>);
+    static_assert(std::is_same_v<StaticMemoryPool<TestObject, 256>::IndexType, uint16_t>);
+    static_assert(std::is_same_v<StaticMemoryPool<TestObject, 70000>::IndexType, uint32_t>);
+    static_assert(StaticMemoryPool<TestObject, 3>::getPoolSize() == 3);
+
+    // Lives entirely on the stack
+    StaticMemoryPool<TestObject, 3> pool;
+    static_assert(sizeof(pool) < 3 * sizeof(TestObject) + 16);
+    assert(pool.isEmpty());
+
+    TestObject* a = pool.create(1, 1.0);
+    TestObject* b = pool.create(2, 2.0);
+    TestObject* c = pool.create(3, 3.0);
+    assert(a && b && c && pool.isFull());
+    assert(pool.allocate() == nullptr);
+    assert(b->value == 2 && c->data == 3.0);
+
+    pool.destroy(b);
+    assert(pool.allocate() == b);
+    pool.deallocate(b);
+    pool.destroy(a);
+    pool.destroy(c);
+    assert(pool.isEmpty());
+
+    TestObject stackObj;
+    try {
+        pool.deallocate(&stackObj);
+        std::cout << "ERROR: Invalid deallocation did not throw!" << std::endl;
+    } catch (const std::invalid_argument& e) {
+        std::cout << "Caught expected exception: " << e.what() << std::endl;
+    }
+
+    // A global static pool works with stateless handles
+    {
+        auto handle = makeStaticPoolUnique<globalStaticPool>("global", 7);
+        assert(handle && handle->id == 7);
+        assert(globalStaticPool.getAvailableSlots() == 3);
+    }
+    assert(globalStaticPool.isEmpty());
+    std::cout << "Static pool test passed." << std::endl;
+}
+
+struct SampledPoolTraits : DefaultPoolTraits {
+    using Stats = SampledPoolStats<1>;
+};
+
+void test_pool_statistics() {
+    std::cout << "\n=== Pool Statistics Test ===" << std::endl;
+    const size_t poolsBefore = PoolRegistry::instance().size();
+    {
+        MemoryPool<TestObject, InstrumentedPoolTraits> pool(4);
+        pool.setName("orders");
+        MemoryPool<TestObject, SampledPoolTraits> sampledPool(2);
+        assert(PoolRegistry::instance().size() == poolsBefore + 2);
+
+        std::vector<TestObject*> objects;
+        for (int i = 0; i < 4; ++i) {
+            objects.push_back(pool.allocate());
+        }
+        assert(pool.allocate() == nullptr);
+        pool.deallocate(objects[0]);
+        pool.deallocate(objects[1]);
+        objects.resize(2);
+        assert(pool.allocateN(objects.data(), 2));
+
+        PoolStatsSnapshot stats = pool.getStats();
+        assert(stats.allocations == 6 && stats.deallocations == 2 && stats.failures == 1);
+        assert(stats.inUse == 4 && stats.highWaterMark == 4 && stats.poolSize == 4);
+
+        sampledPool.deallocate(sampledPool.allocate());
+        assert(sampledPool.getStats().latencySamples == 1);
+
+        // Exporters enumerate every instrumented pool
+        bool found = false;
+        PoolRegistry::instance().forEach([&](const PoolStatsSnapshot& snapshot) {
+            if (snapshot.name != nullptr && std::string(snapshot.name) == "orders") {
+                found = snapshot.inUse == 4;
+            }
+        });
+        assert(found);
+    }
+    assert(PoolRegistry::instance().size() == poolsBefore);
+
+    // Without a statistics policy only occupancy is reported
+    MemoryPool<TestObject> plainPool(2);
+    TestObject* obj = plainPool.allocate();
+    assert(plainPool.getStats().inUse == 1 && plainPool.getStats().allocations == 0);
+    plainPool.deallocate(obj);
+    std::cout << "Pool statistics test passed." << std::endl;
+}
+
+struct ThrowingPoolTraits : DefaultPoolTraits {
+    using OnFailure = ThrowPolicy;
+};
+
+struct HandlerPoolTraits : DefaultPoolTraits {
+    using OnFailure = HandlerPolicy;
+};
+
+struct FallbackPoolTraits : DefaultPoolTraits {
+    using OnFailure = FallbackNewPolicy;
+};
+
+int handledFailures = 0;
+
+void test_failure_policies() {
+    std::cout << "\n=== Failure Policy Test ===" << std::endl;
+
+    MemoryPool<TestObject, ThrowingPoolTraits> throwingPool(1);
+    TestObject* only = throwingPool.allocate();
+    try {
+        throwingPool.allocate();
+        std::cout << "ERROR: Exhausted pool did not throw!" << std::endl;
+    } catch (const std::bad_alloc&) {
+        std::cout << "Caught expected std::bad_alloc from exhausted pool" << std::endl;
+    }
+    throwingPool.deallocate(only);
+
+    HandlerPolicy::handler = [](PoolFailure failure, void*, size_t) {
+        handledFailures += failure == PoolFailure::Exhausted ? 1 : 100;
+    };
+    MemoryPool<TestObject, HandlerPoolTraits> handlerPool(1);
+    TestObject* first = handlerPool.allocate();
+    assert(handlerPool.allocate() == nullptr);
+    TestObject stackObj;
+    handlerPool.deallocate(&stackObj);
+    assert(handledFailures == 101);
+    handlerPool.deallocate(first);
+    HandlerPolicy::handler = nullptr;
+
+    // Overflow objects come from the heap and are freed through the pool
+    MemoryPool<TrackedObject, FallbackPoolTraits> fallbackPool(1);
+    TrackedObject* pooled = fallbackPool.create("pooled", 1);
+    TrackedObject* overflow = fallbackPool.create("overflow", 2);
+    assert(pooled && overflow && fallbackPool.owns(pooled) && !fallbackPool.owns(overflow));
+    fallbackPool.destroy(overflow);
+    fallbackPool.destroy(pooled);
+    assert(fallbackPool.isEmpty() && TrackedObject::liveCount == 0);
+
+    // Batch frees follow the policy too: heap fallbacks are released, and a
+    // non-throwing policy reports foreign pointers while freeing the rest
+    TrackedObject* mixedBatch[3] = {fallbackPool.allocate(), fallbackPool.allocate(), nullptr};
+    assert(fallbackPool.owns(mixedBatch[0]) && !fallbackPool.owns(mixedBatch[1]));
+    fallbackPool.deallocateN(mixedBatch, 3);
+    assert(fallbackPool.isEmpty());
+
+    HandlerPolicy::handler = [](PoolFailure failure, void*, size_t) {
+        handledFailures += failure == PoolFailure::ForeignPointer ? 1 : 100;
+    };
+    handledFailures = 0;
+    TestObject* handlerBatch[2] = {handlerPool.allocate(), &stackObj};
+    handlerPool.deallocateN(handlerBatch, 2);
+    assert(handledFailures == 1 && handlerPool.isEmpty());
+    HandlerPolicy::handler = nullptr;
+    std::cout << "Failure policy test passed." << std::endl;
+}
+
+// Run f and report whether it threw std::invalid_argument
+template <typename F>
+bool throwsInvalidArgument(F&& f) {
+    try {
+        f();
+    } catch (const std::invalid_argument& e) {
+        std::cout << "Caught expected exception: " << e.what() << std::endl;
+        return true;
+    }
+    return false;
+}
+
+void test_hardened_pool() {
+    std::cout << "\n=== Hardened Pool Test ===" << std::endl;
+    MemoryPool<TestObject, HardenedPoolTraits> pool(4);
+
+    TestObject* a = pool.create(1, 1.0);
+    TestObject* b = pool.create(2, 2.0);
+    pool.deallocate(a);
+
+    // A double free is caught instead of corrupting the free list
+    assert(throwsInvalidArgument([&] { pool.deallocate(a); }));
+    assert(pool.getAvailableSlots() == 3);
+    assert(pool.allocate() == a);
+    assert(pool.allocate() != a);
+
+    // Pointers into the middle of a slot are rejected
+    TestObject* inside = reinterpret_cast<TestObject*>(reinterpret_cast<char*>(b) + 4);
+    assert(throwsInvalidArgument([&] { pool.deallocate(inside); }));
+
+    // Pointers below the pool base are foreign rather than a huge offset
+    assert(throwsInvalidArgument([&] { pool.deallocate(a - 1000); }));
+
+#ifndef MEMORY_POOL_ASAN
+    // Writes after free and past the end of an object are detected. Under
+    // ASan these writes fault immediately instead, so they are skipped.
+    pool.deallocate(b);
+    reinterpret_cast<volatile TestObject*>(b)->value = 42;
+    assert(throwsInvalidArgument([&] { pool.allocate(); }));
+
+    TestObject* c = pool.allocate();
+    reinterpret_cast<volatile char*>(c)[sizeof(TestObject)] = 0;
+    assert(throwsInvalidArgument([&] { pool.deallocate(c); }));
+    // The slot is still returned to the pool before the overflow is reported
+    assert(pool.getAvailableSlots() == 1);
+#endif
+    std::cout << "Hardened pool test passed." << std::endl;
+}
+
+void test_address_ordered_pool() {
+    std::cout << "\n=== Address-Ordered Pool Test ===" << std::endl;
+    MemoryPool<TestObject, AddressOrderedPoolTraits> pool(200);
+
+    std::vector<TestObject*> objects;
+    for (int i = 0; i < 200; ++i) {
+        objects.push_back(pool.create(i, i * 1.0));
+    }
+
+    // Free every third object, newest first; reuse still starts from the bottom
+    for (int i = 198; i >= 0; i -= 3) {
+        pool.destroy(objects[i]);
+    }
+    for (int i = 0; i < 199; i += 3) {
+        TestObject* obj = pool.allocate();
+        assert(obj == objects[i]);
+        new (obj) TestObject(i, i * 1.0);
+    }
+    assert(pool.isFull());
+
+    // Live objects are visited in address order
+    pool.destroy(objects[5]);
+    pool.destroy(objects[130]);
+    pool.destroy(objects[64]);
+    TestObject* previous = nullptr;
+    size_t live = 0;
+    pool.forEachLive([&](TestObject* obj) {
+        assert(previous == nullptr || obj > previous);
+        assert(obj != objects[5] && obj != objects[64] && obj != objects[130]);
+        previous = obj;
+        live++;
+    });
+    assert(live == 197);
+
+    // Batch allocation also takes the lowest free slots
+    TestObject* batch[3];
+    assert(pool.allocateN(batch, 3));
+    assert(batch[0] == objects[5] && batch[1] == objects[64] && batch[2] == objects[130]);
+    pool.deallocateN(batch, 3);
+    for (int i = 0; i < 200; ++i) {
+        if (i != 5 && i != 64 && i != 130) {
+            pool.destroy(objects[i]);
+        }
+    }
+    assert(pool.isEmpty());
+
+    live = 0;
+    pool.forEachLive([&](TestObject*) { live++; });
+    assert(live == 0);
+    std::cout << "Address-ordered pool test passed." << std::endl;
+}
+
+template <typename Traits>
+void check_reset_and_iteration() {
+    MemoryPool<TrackedObject, Traits> pool(100);
+    std::vector<TrackedObject*> objects;
+    for (int i = 0; i < 100; ++i) {
+        objects.push_back(pool.create("obj", i));
+    }
+    for (int i = 0; i < 100; i += 7) {
+        pool.destroy(objects[i]);
+    }
+
+    // Every remaining object is visited once, lowest address first
+    int visited = 0;
+    TrackedObject* previous = nullptr;
+    pool.forEachLive([&](TrackedObject* obj) {
+        assert(obj->id % 7 != 0);
+        assert(previous == nullptr || obj > previous);
+        previous = obj;
+        visited++;
+    });
+    assert(visited == TrackedObject::liveCount);
+
+    // reset() runs the remaining destructors and empties the pool
+    pool.reset();
+    assert(TrackedObject::liveCount == 0);
+    assert(pool.isEmpty());
+    assert(pool.create("again", 1) == objects[0]);
+    pool.forEachLive([&](TrackedObject* obj) { assert(obj == objects[0]); });
+    pool.reset();
+    assert(TrackedObject::liveCount == 0);
+}
+
+void test_pool_reset() {
+    std::cout << "\n=== Pool Reset Test ===" << std::endl;
+    check_reset_and_iteration<DefaultPoolTraits>();
+    check_reset_and_iteration<IntrusivePoolTraits>();
+    check_reset_and_iteration<AddressOrderedPoolTraits>();
+    check_reset_and_iteration<HardenedPoolTraits>();
+
+    // Static pools iterate and reset without scratch memory
+    StaticMemoryPool<TrackedObject, 16> staticPool;
+    TrackedObject* staticObjects[16];
+    for (int i = 0; i < 16; ++i) {
+        staticObjects[i] = staticPool.create("static", i);
+    }
+    for (int i = 15; i >= 0; i -= 3) {
+        staticPool.destroy(staticObjects[i]);
+    }
+    int staticVisited = 0;
+    TrackedObject* staticPrevious = nullptr;
+    staticPool.forEachLive([&](TrackedObject* obj) {
+        assert(obj->id % 3 != 0);
+        assert(staticPrevious == nullptr || obj > staticPrevious);
+        staticPrevious = obj;
+        staticVisited++;
+    });
+    assert(staticVisited == TrackedObject::liveCount && staticVisited == 10);
+    staticPool.reset();
+    assert(TrackedObject::liveCount == 0 && staticPool.isEmpty());
+
+    // releaseAll() drops per-request temporaries without visiting them
+    MemoryPool<TestObject> scratch(64);
+    for (int request = 0; request < 3; ++request) {
+        for (int i = 0; i < 50; ++i) {
+            assert(scratch.create(i, i * 1.0) != nullptr);
+        }
+        scratch.releaseAll();
+        assert(scratch.isEmpty());
+    }
+
+    StaticMemoryPool<TestObject, 4> inlinePool;
+    TestObject* first = inlinePool.create(1, 1.0);
+    inlinePool.create(2, 2.0);
+    inlinePool.releaseAll();
+    assert(inlinePool.isEmpty());
+    assert(inlinePool.allocate() == first);
+    std::cout << "Pool reset test passed." << std::endl;
+}
+
+struct TinyHandleTraits : DefaultPoolTraits {
+    using Handle = PoolHandle<uint16_t, 12>;
+};
+
+void test_generational_handles() {
+    std::cout << "\n=== Generational Handle Test ===" << std::endl;
+    static_assert(sizeof(MemoryPool<TestObject, HandlePoolTraits>::Handle) == 4);
+    MemoryPool<TestObject, HandlePoolTraits> pool(8);
+
+    auto h1 = pool.allocateHandle();
+    auto h2 = pool.allocateHandle();
+    assert(h1 && h2 && h1 != h2);
+    TestObject* obj = pool.resolve(h1);
+    assert(obj != nullptr && pool.handleOf(obj) == h1);
+    new (obj) TestObject(7, 7.0);
+    assert(pool.resolve(h1)->value == 7);
+
+    // Freeing through either a handle or a pointer makes old handles stale
+    pool.deallocate(h1);
+    assert(pool.resolve(h1) == nullptr);
+    auto h3 = pool.allocateHandle();
+    assert(h3.index() == h1.index() && h3 != h1);
+    assert(pool.resolve(h1) == nullptr && pool.resolve(h3) == obj);
+    pool.deallocate(pool.resolve(h2));
+    assert(pool.resolve(h2) == nullptr);
+
+    // Stale handles are caught instead of freeing someone else's slot
+    assert(throwsInvalidArgument([&] { pool.deallocate(h1); }));
+    pool.deallocate(decltype(h1)());
+    assert(pool.getAvailableSlots() == 7);
+
+    // releaseAll() invalidates every outstanding handle
+    pool.releaseAll();
+    assert(pool.resolve(h3) == nullptr);
+    auto h4 = pool.allocateHandle();
+    assert(h4.index() == h3.index() && pool.resolve(h3) == nullptr && pool.resolve(h4) != nullptr);
+
+    // A full pool returns a null handle
+    for (int i = 0; i < 7; ++i) {
+        assert(pool.allocateHandle());
+    }
+    assert(!pool.allocateHandle());
+
+    // 16-bit handles with 4 generation bits: a slot survives 15 reuses
+    // before an old handle matches again
+    MemoryPool<TestObject, TinyHandleTraits> tiny(4);
+    static_assert(sizeof(decltype(tiny)::Handle) == 2);
+    auto first = tiny.allocateHandle();
+    TestObject* slot = tiny.resolve(first);
+    for (int reuse = 1; reuse < 15; ++reuse) {
+        tiny.deallocate(slot);
+        assert(tiny.allocate() == slot);
+        assert(tiny.resolve(first) == nullptr);
+    }
+    tiny.deallocate(slot);
+    assert(tiny.allocate() == slot);
+    assert(tiny.resolve(first) == slot);
+    std::cout << "Generational handle test passed." << std::endl;
+}
+
+struct SharedOrder {
+    int owner;
+    int quantity;
+    double price;
+};
+
+void test_shared_memory_pool() {
+    std::cout << "\n=== Shared Memory Pool Test ===" << std::endl;
+    const std::string name = "/fixed_memory_pool_test_" + std::to_string(getpid());
+    SharedMemoryPool<SharedOrder>::remove(name);
+
+    {
+        SharedMemoryPool<SharedOrder> pool(name, 16, SharedPoolOpen::Create);
+        assert(pool.createdRegion() && pool.isEmpty());
+        SharedOrder* order = pool.allocate();
+        *order = {0, 100, 1.5};
+        const uint64_t offset = pool.toOffset(order);
+
+        // Another process attaches, takes the order by offset, frees it and
+        // dies holding three objects of its own
+        pid_t child = fork();
+        if (child == 0) {
+            try {
+                SharedMemoryPool<SharedOrder> attached(name, 16, SharedPoolOpen::Open);
+                SharedOrder* received = attached.fromOffset(offset);
+                bool ok = !attached.createdRegion() && received->quantity == 100 && received->price == 1.5;
+                attached.deallocate(received);
+                for (int i = 0; i < 3; ++i) {
+                    *attached.allocate() = {1, i, 0.0};
+                }
+                _exit(ok ? 0 : 1);
+            } catch (...) {
+                _exit(2);
+            }
+        }
+        int status = 0;
+        waitpid(child, &status, 0);
+        assert(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+        assert(pool.getAvailableSlots() == 13);
+
+        SharedOrder* temporary = pool.allocate();
+        pool.deallocate(temporary);
+        assert(throwsInvalidArgument([&] { pool.deallocate(temporary); }));
+
+        // Racing frees of one slot put it back exactly once
+        for (int round = 0; round < 200; ++round) {
+            SharedOrder* contested = pool.allocate();
+            std::atomic<int> freed{0};
+            auto release = [&] {
+                try {
+                    pool.deallocate(contested);
+                    freed++;
+                } catch (const std::invalid_argument&) {
+                }
+            };
+            std::thread first(release);
+            std::thread second(release);
+            first.join();
+            second.join();
+            assert(freed == 1);
+        }
+        assert(pool.getAvailableSlots() == 13);
+    }
+
+    // A restarted process finds the region and its objects intact
+    {
+        SharedMemoryPool<SharedOrder> pool(name, 0, SharedPoolOpen::Open);
+        assert(!pool.createdRegion() && pool.getPoolSize() == 16);
+        int live = 0;
+        pool.forEachLive([&](SharedOrder* o) {
+            assert(o->owner == 1);
+            live++;
+        });
+        assert(live == 3);
+
+        // Reclaim everything the dead process owned
+        pool.recover([](SharedOrder* o) { return o->owner != 1; });
+        assert(pool.isEmpty());
+        assert(pool.allocate() != nullptr);
+
+        // Attaching with the wrong type or size is refused
+        bool refused = false;
+        try {
+            SharedMemoryPool<uint64_t> wrongType(name, 0, SharedPoolOpen::Open);
+        } catch (const std::runtime_error&) {
+            refused = true;
+        }
+        assert(refused);
+    }
+
+    assert(SharedMemoryPool<SharedOrder>::remove(name));
+    bool missing = false;
+    try {
+        SharedMemoryPool<SharedOrder> gone(name, 16, SharedPoolOpen::Open);
+    } catch (const std::system_error&) {
+        missing = true;
+    }
+    assert(missing);
+    std::cout << "Shared memory pool test passed." << std::endl;
+}
+
+struct Position {
+    int id;
+    double price;
+    double quantity;
+};
+
+void test_soa_pool() {
+    std::cout << "\n=== Structure-of-Arrays Pool Test ===" << std::endl;
+    SoAMemoryPool<Position, &Position::price, &Position::quantity> pool(200);
+    using Pool = decltype(pool);
+    static_assert(std::is_same_v<Pool::FieldType<&Position::price>, double>);
+
+    for (int i = 0; i < 200; ++i) {
+        size_t slot = pool.create({i, 1.0 * i, 2.0});
+        assert(slot == static_cast<size_t>(i));
+    }
+    assert(pool.isFull() && pool.allocate() == Pool::invalidSlot);
+    assert(reinterpret_cast<uintptr_t>(pool.column<&Position::price>()) % 64 == 0);
+
+    // Fields are reachable through the proxy and as plain arrays
+    pool[7].get<&Position::quantity>() = 3.0;
+    Position p = pool[7];
+    assert(p.id == 0 && p.price == 7.0 && p.quantity == 3.0);
+    assert(pool.column<&Position::quantity>()[7] == 3.0);
+
+    // Freed slots read as zero and are reused lowest first
+    pool.deallocate(10);
+    pool.deallocate(11);
+    pool.deallocate(130);
+    assert(pool.column<&Position::price>()[11] == 0.0 && !pool.isLive(11));
+    assert(throwsInvalidArgument([&] { pool.deallocate(11); }));
+    assert(throwsInvalidArgument([&] { pool.deallocate(500); }));
+
+    std::vector<std::pair<size_t, size_t>> runs;
+    pool.forEachLiveRun([&](size_t first, size_t last) { runs.push_back({first, last}); });
+    assert((runs == std::vector<std::pair<size_t, size_t>>{{0, 10}, {12, 130}, {131, 200}}));
+
+    // Whole-column and run-wise reductions agree
+    const double* price = pool.column<&Position::price>();
+    const double* quantity = pool.column<&Position::quantity>();
+    double whole = 0.0;
+    for (size_t i = 0; i < pool.getPoolSize(); ++i) {
+        whole += price[i] * quantity[i];
+    }
+    double byRuns = 0.0;
+    pool.forEachLiveRun([&](size_t first, size_t last) {
+        for (size_t i = first; i < last; ++i) {
+            byRuns += price[i] * quantity[i];
+        }
+    });
+    size_t live = 0;
+    pool.forEachLive([&](size_t) { live++; });
+    assert(whole == byRuns && live == 197);
+
+    assert(pool.allocate() == 10);
+    assert(pool.allocate() == 11);
+    assert(pool.allocate() == 130);
+    std::cout << "Structure-of-arrays pool test passed." << std::endl;
+}
+
+// Lazily started coroutine returning an int, with its frame from Source
+template <typename Source>
+struct PooledTask {
+    struct promise_type : PooledCoroutineFrame<Source> {
+        int result = 0;
+
+        PooledTask get_return_object() { return PooledTask(std::coroutine_handle<promise_type>::from_promise(*this)); }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+        void return_value(int value) { result = value; }
+        void unhandled_exception() { throw; }
+    };
+
+    explicit PooledTask(std::coroutine_handle<promise_type> handle) : handle(handle) {}
+    PooledTask(PooledTask&& other) noexcept : handle(std::exchange(other.handle, {})) {}
+    ~PooledTask() {
+        if (handle) {
+            handle.destroy();
+        }
+    }
+
+    int run() {
+        handle.resume();
+        return handle.promise().result;
+    }
+
+    std::coroutine_handle<promise_type> handle;
+};
+
+using FrameSource = ConcurrentFrameSource<16>;
+
+PooledTask<FrameSource> addLater(int a, int b) {
+    co_return a + b;
+}
+
+PooledTask<FrameSource> sumLarge(int n) {
+    volatile char scratch[8192] = {};
+    scratch[n] = static_cast<char>(n);
+    co_return scratch[n] + n;
+}
+
+PooledTask<ThreadLocalFrameSource<>> multiplyLater(int a, int b) {
+    co_return a * b;
+}
+
+void test_coroutine_frames() {
+    std::cout << "\n=== Coroutine Frame Pool Test ===" << std::endl;
+
+    // Measure the frame class by its effect on the pool
+    const size_t before = FrameSource::getAvailableFrames(64);
+    {
+        PooledTask<FrameSource> task = addLater(2, 3);
+        size_t inUse = 0;
+        for (size_t size = 64; size <= FrameSource::maxFrameSize; size += 64) {
+            inUse += FrameSource::getAvailableFrames(size) < 16;
+        }
+        assert(inUse == 1);
+        assert(task.run() == 5);
+    }
+    assert(FrameSource::getAvailableFrames(64) == before);
+
+    // Exhausting a class and oversize frames both fall back to operator new
+    {
+        std::vector<PooledTask<FrameSource>> tasks;
+        for (int i = 0; i < 40; ++i) {
+            tasks.push_back(addLater(i, 1));
+        }
+        for (int i = 0; i < 40; ++i) {
+            assert(tasks[i].run() == i + 1);
+        }
+        assert(sumLarge(3).run() == 6);
+    }
+
+    // Frames destroyed on another thread go back to the shared pools
+    {
+        PooledTask<FrameSource> task = addLater(4, 4);
+        std::thread other([&task] { assert(task.run() == 8); task.handle.destroy(); task.handle = {}; });
+        other.join();
+    }
+
+    assert(multiplyLater(6, 7).run() == 42);
+    std::cout << "Coroutine frame pool test passed." << std::endl;
+}
+
+// Node whose destructor poisons it, so a reader that sees a freed node notices
+struct EpochNode {
+    static constexpr uint64_t liveMark = 0x600DF00D;
+
+    uint64_t mark = liveMark;
+    uint64_t payload;
+
+    explicit EpochNode(uint64_t payload) : payload(payload) {}
+    ~EpochNode() { mark = 0; }
+};
+
+void test_epoch_reclamation() {
+    std::cout << "\n=== Epoch Reclamation Test ===" << std::endl;
+
+    // A reader inside a critical section holds back reclamation
+    {
+        EpochMemoryPool<EpochNode> pool(8);
+        EpochNode* node = pool.create(7);
+        std::atomic<int> phase{0};
+        std::thread reader([&]() {
+            EpochMemoryPool<EpochNode>::Guard guard(pool);
+            phase.store(1);
+            while (phase.load() != 2) {
+                std::this_thread::yield();
+            }
+            assert(node->mark == EpochNode::liveMark && node->payload == 7);
+            pool.detachThread();
+        });
+        while (phase.load() != 1) {
+            std::this_thread::yield();
+        }
+
+        pool.retire(node);
+        for (int i = 0; i < 10; ++i) {
+            assert(pool.collect() == 0);
+        }
+        assert(pool.getAvailableSlots() == 7);
+        phase.store(2);
+        reader.join();
+
+        size_t freed = 0;
+        for (int i = 0; i < 3; ++i) {
+            freed += pool.collect();
+        }
+        assert(freed == 1);
+        assert(pool.isEmpty());
+
+        // Exhaustion reclaims retired slots before giving up
+        std::vector<EpochNode*> nodes;
+        while (EpochNode* n = pool.create(1)) {
+            nodes.push_back(n);
+        }
+        assert(nodes.size() == 8);
+        pool.retire(nodes.back());
+        nodes.back() = pool.create(2);
+        assert(nodes.back() != nullptr && nodes.back()->payload == 2);
+        for (EpochNode* n : nodes) {
+            pool.destroy(n);
+        }
+    }
+
+    // Writers keep replacing shared nodes while readers check them; a
+    // node freed too early would read as poisoned or be reused
+    {
+        const size_t cellCount = 4;
+        EpochMemoryPool<EpochNode> pool(256);
+        std::atomic<EpochNode*> cells[cellCount];
+        for (size_t c = 0; c < cellCount; ++c) {
+            cells[c].store(pool.create(c));
+        }
+        std::atomic<bool> stop{false};
+        std::vector<std::thread> threads;
+        for (int r = 0; r < 3; ++r) {
+            threads.emplace_back([&]() {
+                while (!stop.load(std::memory_order_relaxed)) {
+                    {
+                        EpochMemoryPool<EpochNode>::Guard guard(pool);
+                        for (size_t c = 0; c < cellCount; ++c) {
+                            EpochNode* node = cells[c].load(std::memory_order_acquire);
+                            uint64_t payload = node->payload;
+                            assert(node->mark == EpochNode::liveMark);
+                            assert(payload % cellCount == c);
+                            (void)payload;
+                        }
+                    }
+                    std::this_thread::yield();
+                }
+                pool.detachThread();
+            });
+        }
+        threads.emplace_back([&]() {
+            for (uint64_t i = cellCount; i < 20000; ++i) {
+                // Readers may hold back a few epochs; wait for them
+                EpochNode* node;
+                while ((node = pool.create(i)) == nullptr) {
+                    std::this_thread::yield();
+                }
+                pool.retire(cells[i % cellCount].exchange(node, std::memory_order_acq_rel));
+            }
+            stop.store(true);
+            pool.detachThread();
+        });
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        for (auto& cell : cells) {
+            pool.destroy(cell.load());
+        }
+    }
+
+    std::cout << "Epoch reclamation test passed." << std::endl;
+}
+
 int main()
 {
     test_basic_allocation();
@@ -131,6 +1334,27 @@ int main()
     test_empty_pool();
     test_invalid_deallocation();
     test_multiple_alloc_dealloc();
+    test_concurrent_pool();
+    test_growable_pool();
+    test_intrusive_pool();
+    test_lazy_initialization();
+    test_backing_options();
+    test_cache_aligned_pool();
+    test_batch_operations();
+    test_object_lifetime();
+    test_container_allocators();
+    test_size_class_pool();
+    test_static_pool();
+    test_pool_statistics();
+    test_failure_policies();
+    test_hardened_pool();
+    test_address_ordered_pool();
+    test_pool_reset();
+    test_generational_handles();
+    test_shared_memory_pool();
+    test_soa_pool();
+    test_coroutine_frames();
+    test_epoch_reclamation();
 
     std::cout << "\nAll tests completed." << std::endl;
     return 0;
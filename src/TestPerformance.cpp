@@ -1,11 +1,34 @@
 #include "MemoryPool.h"
+#include "ConcurrentMemoryPool.h"
+#include "PoolAllocator.h"
+#include "SizeClassPool.h"
+#include "StaticMemoryPool.h"
+#include "SoAMemoryPool.h"
+#include "CoroutineFramePool.h"
+#include "EpochMemoryPool.h"
 #include <iostream>
+#include <coroutine>
 #include <vector>
 #include <chrono>
 #include <random>
 #include <algorithm>
 #include <iomanip>
 #include <memory>
+#include <numeric>
+#include <thread>
+#include <mutex>
+#include <fstream>
+#include <list>
+#include <unordered_map>
+#include <cerrno>
+#include <cstring>
+#include <unistd.h>
+#include <sys/resource.h>
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#endif
 
 // Test object for performance testing
 class PerformanceTestObject {
@@ -67,7 +90,7 @@ void testAllocationLatency() {
         timer.stop();
         
         if (obj) {
-            *obj = PerformanceTestObject(static_cast<int>(i), i * 3.14159);
+            new (obj) PerformanceTestObject(static_cast<int>(i), i * 3.14159);
             latencies.push_back(timer.getNanoseconds());
         } else {
             std::cout << "Pool exhausted at iteration " << i << std::endl;
@@ -107,7 +130,7 @@ void testDeallocationLatency() {
     for (size_t i = 0; i < poolSize; ++i) {
         PerformanceTestObject* obj = pool.allocate();
         if (obj) {
-            *obj = PerformanceTestObject(static_cast<int>(i), i * 2.71828);
+            new (obj) PerformanceTestObject(static_cast<int>(i), i * 2.71828);
             objects.push_back(obj);
         }
     }
@@ -156,8 +179,7 @@ void testMixedOperationsLatency() {
     std::vector<double> allocationLatencies;
     std::vector<double> deallocationLatencies;
     
-    std::random_device rd;
-    std::mt19937 gen(rd());
+    std::mt19937 gen(42);
     std::uniform_real_distribution<> dis(0.0, 1.0);
     
     std::cout << "Testing mixed operations for " << iterations << " iterations..." << std::endl;
@@ -170,7 +192,7 @@ void testMixedOperationsLatency() {
             timer.stop();
             
             if (obj) {
-                *obj = PerformanceTestObject(static_cast<int>(i), i * 1.414);
+                new (obj) PerformanceTestObject(static_cast<int>(i), i * 1.414);
                 activeObjects.push_back(obj);
                 allocationLatencies.push_back(timer.getNanoseconds());
             }
@@ -183,7 +205,8 @@ void testMixedOperationsLatency() {
             timer.stop();
             
             deallocationLatencies.push_back(timer.getNanoseconds());
-            activeObjects.erase(activeObjects.begin() + index);
+            activeObjects[index] = activeObjects.back();
+            activeObjects.pop_back();
         }
     }
     
@@ -235,10 +258,9 @@ void compareWithStandardAllocation() {
     std::cout << "Testing MemoryPool performance..." << std::endl;
     timer.start();
     for (size_t i = 0; i < iterations; ++i) {
-        PerformanceTestObject* obj = pool.allocate();
+        PerformanceTestObject* obj = pool.create(static_cast<int>(i), i * 3.14159);
         if (obj) {
-            *obj = PerformanceTestObject(static_cast<int>(i), i * 3.14159);
-            pool.deallocate(obj);
+            pool.destroy(obj);
         }
     }
     timer.stop();
@@ -262,19 +284,65 @@ void compareWithStandardAllocation() {
     std::cout << "  Time per operation:" << std::endl;
     std::cout << "    MemoryPool: " << (poolTime / iterations) << " microseconds" << std::endl;
     std::cout << "    new/delete: " << (standardTime / iterations) << " microseconds" << std::endl;
+    
+    // Mixed-size small allocations: SizeClassPool against malloc/free
+    const size_t liveBlocks = 1024;
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<size_t> sizeDis(8, 512);
+    std::vector<size_t> sizes(iterations);
+    for (auto& size : sizes) {
+        size = sizeDis(gen);
+    }
+    std::vector<std::pair<void*, size_t>> blocks(liveBlocks, {nullptr, 0});
+    
+    SizeClassPool<> sizeClassPool(1 << 20);
+    std::cout << "Testing SizeClassPool mixed-size performance..." << std::endl;
+    timer.start();
+    for (size_t i = 0; i < iterations; ++i) {
+        auto& slot = blocks[i % liveBlocks];
+        sizeClassPool.deallocate(slot.first, slot.second);
+        slot = {sizeClassPool.allocate(sizes[i]), sizes[i]};
+        static_cast<char*>(slot.first)[0] = static_cast<char>(i);
+    }
+    for (auto& slot : blocks) {
+        sizeClassPool.deallocate(slot.first, slot.second);
+        slot = {nullptr, 0};
+    }
+    timer.stop();
+    double sizeClassTime = timer.getMicroseconds();
+    
+    std::cout << "Testing malloc/free mixed-size performance..." << std::endl;
+    timer.start();
+    for (size_t i = 0; i < iterations; ++i) {
+        auto& slot = blocks[i % liveBlocks];
+        std::free(slot.first);
+        slot = {std::malloc(sizes[i]), sizes[i]};
+        static_cast<char*>(slot.first)[0] = static_cast<char>(i);
+    }
+    for (auto& slot : blocks) {
+        std::free(slot.first);
+        slot = {nullptr, 0};
+    }
+    timer.stop();
+    double mallocTime = timer.getMicroseconds();
+    
+    std::cout << "Mixed-size Comparison (" << iterations << " allocations of 8..512 bytes, " << liveBlocks << " live):" << std::endl;
+    std::cout << "  SizeClassPool: " << sizeClassTime << " microseconds" << std::endl;
+    std::cout << "  malloc/free:   " << mallocTime << " microseconds" << std::endl;
+    std::cout << "  Speedup:       " << (mallocTime / sizeClassTime) << "x faster" << std::endl;
 }
 
+// Object types for the size tests
+struct SmallObject { int x; };
+struct MediumObject { int x; double y; char data[32]; };
+struct LargeObject { int x; double y; char data[256]; };
+
 // Test different object sizes
 void testDifferentObjectSizes() {
     std::cout << "\n=== Different Object Sizes Test ===" << std::endl;
     
     const size_t iterations = 100000;
     
-    // Test with different object types
-    struct SmallObject { int x; };
-    struct MediumObject { int x; double y; char data[32]; };
-    struct LargeObject { int x; double y; char data[256]; };
-    
     std::cout << "Testing with different object sizes..." << std::endl;
     
     // Small objects
@@ -291,6 +359,19 @@ void testDifferentObjectSizes() {
     timer.stop();
     double smallTime = timer.getMicroseconds();
     
+    // Small objects with the free list embedded in the slots
+    MemoryPool<SmallObject, IntrusivePoolTraits> smallIntrusivePool(iterations);
+    timer.start();
+    for (size_t i = 0; i < iterations; ++i) {
+        SmallObject* obj = smallIntrusivePool.allocate();
+        if (obj) {
+            obj->x = static_cast<int>(i);
+            smallIntrusivePool.deallocate(obj);
+        }
+    }
+    timer.stop();
+    double smallIntrusiveTime = timer.getMicroseconds();
+    
     // Medium objects
     MemoryPool<MediumObject> mediumPool(iterations);
     timer.start();
@@ -322,10 +403,1038 @@ void testDifferentObjectSizes() {
     std::cout << std::fixed << std::setprecision(2);
     std::cout << "Object Size Performance (" << iterations << " allocate/deallocate cycles):" << std::endl;
     std::cout << "  Small objects (" << sizeof(SmallObject) << " bytes): " << smallTime << " microseconds" << std::endl;
+    std::cout << "  Small objects, intrusive free list (" << sizeof(SmallObject) << " bytes): " << smallIntrusiveTime << " microseconds" << std::endl;
+    std::cout << "  Small object footprint per slot: " << sizeof(SmallObject) + sizeof(size_t)
+              << " bytes (offset array) vs " << sizeof(SmallObject) << " bytes (intrusive)" << std::endl;
     std::cout << "  Medium objects (" << sizeof(MediumObject) << " bytes): " << mediumTime << " microseconds" << std::endl;
     std::cout << "  Large objects (" << sizeof(LargeObject) << " bytes): " << largeTime << " microseconds" << std::endl;
 }
 
+#if defined(__linux__)
+// Per-thread event counters read through perf_event_open. Each event is
+// opened on its own, so a CPU or VM that lacks some of them (or a kernel
+// whose perf_event_paranoid forbids them) still reports the rest; missing
+// events read as unavailable instead of failing the run.
+class PerfCounters {
+public:
+    enum Event { Cycles, Instructions, L1DMisses, LLCMisses, DTLBMisses, PageFaults, BranchMisses, EventCount };
+
+    PerfCounters() {
+        for (int e = 0; e < EventCount; ++e) {
+            fds[e] = open(static_cast<Event>(e));
+            errors[e] = fds[e] < 0 ? errno : 0;
+            values[e] = -1.0;
+        }
+    }
+
+    ~PerfCounters() {
+        for (int fd : fds) {
+            if (fd >= 0) {
+                close(fd);
+            }
+        }
+    }
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    void start() {
+        for (int fd : fds) {
+            if (fd >= 0) {
+                ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+                ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+            }
+        }
+    }
+
+    void stop() {
+        for (int fd : fds) {
+            if (fd >= 0) {
+                ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+            }
+        }
+
+        // Scale for multiplexing; an event that never got a counter is unavailable
+        for (int e = 0; e < EventCount; ++e) {
+            uint64_t raw[3];
+            values[e] = -1.0;
+            if (fds[e] >= 0 && read(fds[e], raw, sizeof(raw)) == static_cast<ssize_t>(sizeof(raw)) && raw[2] > 0) {
+                values[e] = static_cast<double>(raw[0]) * static_cast<double>(raw[1]) / static_cast<double>(raw[2]);
+            }
+        }
+    }
+
+    // Count from the last start/stop divided by ops, or a negative value when unavailable
+    double perOperation(Event e, size_t ops) const {
+        return values[e] < 0 ? -1.0 : values[e] / static_cast<double>(ops);
+    }
+
+    bool anyAvailable() const {
+        return std::any_of(std::begin(fds), std::end(fds), [](int fd) { return fd >= 0; });
+    }
+
+    static const char* name(Event e) {
+        static const char* const names[] = {"cycles", "instr", "L1D-miss", "LLC-miss", "dTLB-miss", "faults", "br-miss"};
+        return names[e];
+    }
+
+    // Why an event could not be opened, empty if it was
+    std::string unavailableReason(Event e) const {
+        return fds[e] >= 0 ? std::string() : std::strerror(errors[e]);
+    }
+
+private:
+    static int open(Event e) {
+        perf_event_attr attr{};
+        attr.size = sizeof(attr);
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        auto cacheMiss = [](uint64_t cache) {
+            return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        };
+        switch (e) {
+        case Cycles:       attr.type = PERF_TYPE_HARDWARE; attr.config = PERF_COUNT_HW_CPU_CYCLES; break;
+        case Instructions: attr.type = PERF_TYPE_HARDWARE; attr.config = PERF_COUNT_HW_INSTRUCTIONS; break;
+        case L1DMisses:    attr.type = PERF_TYPE_HW_CACHE; attr.config = cacheMiss(PERF_COUNT_HW_CACHE_L1D); break;
+        case LLCMisses:    attr.type = PERF_TYPE_HARDWARE; attr.config = PERF_COUNT_HW_CACHE_MISSES; break;
+        case DTLBMisses:   attr.type = PERF_TYPE_HW_CACHE; attr.config = cacheMiss(PERF_COUNT_HW_CACHE_DTLB); break;
+        case PageFaults:   attr.type = PERF_TYPE_SOFTWARE; attr.config = PERF_COUNT_SW_PAGE_FAULTS; break;
+        case BranchMisses: attr.type = PERF_TYPE_HARDWARE; attr.config = PERF_COUNT_HW_BRANCH_MISSES; break;
+        default: return -1;
+        }
+        return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+    }
+
+    int fds[EventCount];
+    int errors[EventCount];
+    double values[EventCount];
+};
+
+#else
+
+// perf_event_open is Linux only; elsewhere every counter is unavailable and
+// the profile reports wall-clock time alone
+class PerfCounters {
+public:
+    enum Event { Cycles, Instructions, L1DMisses, LLCMisses, DTLBMisses, PageFaults, BranchMisses, EventCount };
+
+    void start() {}
+    void stop() {}
+    double perOperation(Event, size_t) const { return -1.0; }
+    bool anyAvailable() const { return false; }
+
+    static const char* name(Event e) {
+        static const char* const names[] = {"cycles", "instr", "L1D-miss", "LLC-miss", "dTLB-miss", "faults", "br-miss"};
+        return names[e];
+    }
+
+    std::string unavailableReason(Event) const { return "perf_event_open needs Linux"; }
+};
+
+#endif
+
+// Run body once under the counters and print one row per operation
+template <typename Body>
+void profileScenario(PerfCounters& counters, const std::string& label, size_t ops, Body&& body) {
+    PerformanceTimer timer;
+    counters.start();
+    timer.start();
+    body();
+    timer.stop();
+    counters.stop();
+
+    std::cout << "  " << std::left << std::setw(30) << label << std::right << std::setw(8) << timer.getNanoseconds() / ops;
+    for (int e = 0; e < PerfCounters::EventCount; ++e) {
+        double value = counters.perOperation(static_cast<PerfCounters::Event>(e), ops);
+        if (value < 0) {
+            std::cout << std::setw(10) << "n/a";
+        } else {
+            std::cout << std::setw(10) << std::setprecision(3) << value << std::setprecision(2);
+        }
+    }
+    std::cout << std::endl;
+}
+
+// First touch of a fresh pool, then steady churn on the warmed pool
+template <typename Object, typename Traits = DefaultPoolTraits>
+void profileObjectSize(PerfCounters& counters, const std::string& label, size_t iterations) {
+    MemoryPool<Object, Traits> pool(iterations);
+    std::vector<Object*> objects(iterations);
+
+    profileScenario(counters, label + " first touch", iterations, [&]() {
+        for (size_t i = 0; i < iterations; ++i) {
+            objects[i] = pool.allocate();
+            objects[i]->x = static_cast<int>(i);
+        }
+    });
+    for (Object* obj : objects) {
+        pool.deallocate(obj);
+    }
+
+    profileScenario(counters, label + " churn", iterations, [&]() {
+        for (size_t i = 0; i < iterations; ++i) {
+            Object* obj = pool.allocate();
+            obj->x = static_cast<int>(i);
+            pool.deallocate(obj);
+        }
+    });
+}
+
+// Hardware counters per operation for the object sizes above
+void testHardwareCounters() {
+    std::cout << "\n=== Hardware Counter Profile ===" << std::endl;
+
+    PerfCounters counters;
+    if (!counters.anyAvailable()) {
+        std::cout << "perf_event_open unavailable (" << counters.unavailableReason(PerfCounters::Cycles) << ")";
+#if defined(__linux__)
+        std::cout << "; check /proc/sys/kernel/perf_event_paranoid";
+#endif
+        std::cout << ". Reporting wall clock only." << std::endl;
+    } else {
+        std::string missing;
+        for (int e = 0; e < PerfCounters::EventCount; ++e) {
+            auto event = static_cast<PerfCounters::Event>(e);
+            if (!counters.unavailableReason(event).empty()) {
+                missing += std::string(missing.empty() ? "" : ", ") + PerfCounters::name(event) + " ("
+                           + counters.unavailableReason(event) + ")";
+            }
+        }
+        if (!missing.empty()) {
+            std::cout << "Counters unavailable here: " << missing << std::endl;
+        }
+    }
+
+    const size_t iterations = 100000;
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "Per operation (" << iterations << " operations per row):" << std::endl;
+    std::cout << "  " << std::left << std::setw(30) << "scenario" << std::right << std::setw(8) << "ns";
+    for (int e = 0; e < PerfCounters::EventCount; ++e) {
+        std::cout << std::setw(10) << PerfCounters::name(static_cast<PerfCounters::Event>(e));
+    }
+    std::cout << std::endl;
+
+    profileObjectSize<SmallObject>(counters, "small (" + std::to_string(sizeof(SmallObject)) + " B)", iterations);
+    profileObjectSize<SmallObject, IntrusivePoolTraits>(counters, "small intrusive", iterations);
+    profileObjectSize<MediumObject>(counters, "medium (" + std::to_string(sizeof(MediumObject)) + " B)", iterations);
+    profileObjectSize<LargeObject>(counters, "large (" + std::to_string(sizeof(LargeObject)) + " B)", iterations);
+}
+
+// Resident set size of this process in KiB, or 0 where unavailable
+size_t residentKilobytes() {
+    std::ifstream statm("/proc/self/statm");
+    size_t totalPages = 0;
+    size_t residentPages = 0;
+    if (!(statm >> totalPages >> residentPages)) {
+        return 0;
+    }
+    return residentPages * (static_cast<size_t>(sysconf(_SC_PAGESIZE)) / 1024);
+}
+
+// Construct a huge pool and touch a few slots; startup should not depend on pool size
+template <typename Traits>
+void measurePoolStartup(const char* label, size_t poolSize, size_t touched) {
+    PerformanceTimer timer;
+    size_t rssBefore = residentKilobytes();
+
+    timer.start();
+    MemoryPool<PerformanceTestObject, Traits> pool(poolSize);
+    timer.stop();
+    double constructTime = timer.getMicroseconds();
+
+    for (size_t i = 0; i < touched; ++i) {
+        PerformanceTestObject* obj = pool.allocate();
+        obj->id = static_cast<int>(i);
+    }
+    size_t rssAfter = residentKilobytes();
+
+    std::cout << "  " << label << ": construct " << constructTime << " microseconds, RSS +"
+              << (rssAfter - rssBefore) << " KiB after " << touched << " allocations" << std::endl;
+}
+
+void testPoolStartup() {
+    std::cout << "\n=== Pool Startup Test ===" << std::endl;
+
+    const size_t poolSize = 10000000;
+    const size_t touched = 10000;
+
+    std::cout << "Constructing " << poolSize << "-slot pools..." << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+    measurePoolStartup<DefaultPoolTraits>("malloc backing", poolSize, touched);
+    measurePoolStartup<IntrusivePoolTraits>("malloc backing, intrusive", poolSize, touched);
+#if defined(__unix__) || defined(__APPLE__)
+    measurePoolStartup<MmapPoolTraits>("mmap backing", poolSize, touched);
+#endif
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+// Minor + major page faults taken by this process so far
+long pageFaultCount() {
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_minflt + usage.ru_majflt;
+}
+
+// Page faults during construction and during the first pass over the pool
+void measureBackingFaults(const char* label, size_t poolSize, const MmapBacking& backing) {
+    PerformanceTimer timer;
+    long faultsBefore = pageFaultCount();
+    timer.start();
+    MemoryPool<PerformanceTestObject, MmapPoolTraits> pool(poolSize, backing);
+    timer.stop();
+    long constructFaults = pageFaultCount() - faultsBefore;
+    double constructTime = timer.getMicroseconds();
+
+    faultsBefore = pageFaultCount();
+    timer.start();
+    for (size_t i = 0; i < poolSize; ++i) {
+        PerformanceTestObject* obj = pool.allocate();
+        obj->id = static_cast<int>(i);
+    }
+    timer.stop();
+    long useFaults = pageFaultCount() - faultsBefore;
+
+    std::cout << "  " << std::left << std::setw(30) << label << std::right
+              << " construct: " << std::setw(10) << constructTime << " us, " << std::setw(7) << constructFaults << " faults"
+              << " | first use: " << std::setw(10) << timer.getMicroseconds() << " us, " << std::setw(7) << useFaults << " faults"
+              << std::endl;
+}
+
+void testBackingPageFaults() {
+    std::cout << "\n=== Backing Store Page Fault Test ===" << std::endl;
+
+    const size_t poolSize = 1000000;
+    std::cout << "Allocating every slot of a " << poolSize << "-slot pool..." << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+
+    MmapBacking lazy;
+    measureBackingFaults("mmap, fault on touch", poolSize, lazy);
+
+    MmapBacking populated;
+    populated.populate = true;
+    measureBackingFaults("mmap, pre-faulted", poolSize, populated);
+
+    MmapBacking huge;
+    huge.hugePages = true;
+    measureBackingFaults("mmap, huge pages", poolSize, huge);
+
+    MmapBacking hugePopulated;
+    hugePopulated.hugePages = true;
+    hugePopulated.populate = true;
+    measureBackingFaults("mmap, huge pages, pre-faulted", poolSize, hugePopulated);
+}
+#endif
+
+// Push/pop churn through a list; returns microseconds
+template <typename List>
+double measureListChurn(List& list, size_t iterations) {
+    PerformanceTimer timer;
+    timer.start();
+    for (size_t i = 0; i < iterations; ++i) {
+        list.push_back(static_cast<int>(i));
+        if (list.size() > 1000) {
+            list.pop_front();
+        }
+    }
+    list.clear();
+    timer.stop();
+    return timer.getMicroseconds();
+}
+
+// Insert/erase churn through a hash map; returns microseconds
+template <typename Map>
+double measureMapChurn(Map& map, size_t iterations) {
+    PerformanceTimer timer;
+    timer.start();
+    for (size_t i = 0; i < iterations; ++i) {
+        map.emplace(static_cast<int>(i), static_cast<int>(i));
+        if (i >= 1000) {
+            map.erase(static_cast<int>(i - 1000));
+        }
+    }
+    map.clear();
+    timer.stop();
+    return timer.getMicroseconds();
+}
+
+// Compare node-based containers with default and pooled allocation
+void testContainerAllocators() {
+    std::cout << "\n=== Container Allocator Test ===" << std::endl;
+
+    const size_t iterations = 1000000;
+    DefaultPoolMemoryResource resource;
+
+    std::cout << "Testing " << iterations << " insert/erase operations per container..." << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+
+    std::list<int> defaultList;
+    std::list<int, PoolAllocator<int>> pooledList{PoolAllocator<int>(resource)};
+    std::pmr::list<int> pmrList(&resource);
+    std::cout << "  std::list, std::allocator:     " << measureListChurn(defaultList, iterations) << " microseconds" << std::endl;
+    std::cout << "  std::list, PoolAllocator:      " << measureListChurn(pooledList, iterations) << " microseconds" << std::endl;
+    std::cout << "  std::pmr::list, pool resource: " << measureListChurn(pmrList, iterations) << " microseconds" << std::endl;
+
+    using MapAllocator = PoolAllocator<std::pair<const int, int>>;
+    std::unordered_map<int, int> defaultMap;
+    std::unordered_map<int, int, std::hash<int>, std::equal_to<int>, MapAllocator> pooledMap{MapAllocator(resource)};
+    std::pmr::unordered_map<int, int> pmrMap(&resource);
+    std::cout << "  std::unordered_map, std::allocator:     " << measureMapChurn(defaultMap, iterations) << " microseconds" << std::endl;
+    std::cout << "  std::unordered_map, PoolAllocator:      " << measureMapChurn(pooledMap, iterations) << " microseconds" << std::endl;
+    std::cout << "  std::pmr::unordered_map, pool resource: " << measureMapChurn(pmrMap, iterations) << " microseconds" << std::endl;
+}
+
+StaticMemoryPool<PerformanceTestObject, 1024> staticPerformancePool;
+
+// Compare a heap-backed MemoryPool with an inline StaticMemoryPool of the same capacity
+void testStaticPool() {
+    std::cout << "\n=== Static Pool Test ===" << std::endl;
+
+    const size_t capacity = 1024;
+    const size_t rounds = 20000;
+    MemoryPool<PerformanceTestObject> heapPool(capacity);
+    std::vector<PerformanceTestObject*> objects(capacity);
+    PerformanceTimer timer;
+
+    std::cout << "Filling and draining " << capacity << "-slot pools " << rounds << " times..." << std::endl;
+
+    timer.start();
+    for (size_t r = 0; r < rounds; ++r) {
+        for (size_t i = 0; i < capacity; ++i) {
+            objects[i] = heapPool.allocate();
+            objects[i]->id = static_cast<int>(i);
+        }
+        for (size_t i = 0; i < capacity; ++i) {
+            heapPool.deallocate(objects[i]);
+        }
+    }
+    timer.stop();
+    double heapTime = timer.getMicroseconds();
+
+    timer.start();
+    for (size_t r = 0; r < rounds; ++r) {
+        for (size_t i = 0; i < capacity; ++i) {
+            objects[i] = staticPerformancePool.allocate();
+            objects[i]->id = static_cast<int>(i);
+        }
+        for (size_t i = 0; i < capacity; ++i) {
+            staticPerformancePool.deallocate(objects[i]);
+        }
+    }
+    timer.stop();
+    double staticTime = timer.getMicroseconds();
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "  MemoryPool:       " << heapTime << " microseconds" << std::endl;
+    std::cout << "  StaticMemoryPool: " << staticTime << " microseconds" << std::endl;
+}
+
+struct SampledPerformanceTraits : DefaultPoolTraits {
+    using Stats = SampledPoolStats<1024>;
+};
+
+// Measure the cost of statistics and print the sampled latency histogram
+void testPoolStatistics() {
+    std::cout << "\n=== Pool Statistics Overhead Test ===" << std::endl;
+
+    const size_t iterations = 10000000;
+    PerformanceTimer timer;
+
+    auto churn = [&](auto& pool) {
+        timer.start();
+        for (size_t i = 0; i < iterations; ++i) {
+            PerformanceTestObject* obj = pool.allocate();
+            obj->id = static_cast<int>(i);
+            pool.deallocate(obj);
+        }
+        timer.stop();
+        return timer.getMicroseconds();
+    };
+
+    MemoryPool<PerformanceTestObject> plainPool(16);
+    MemoryPool<PerformanceTestObject, InstrumentedPoolTraits> countedPool(16);
+    MemoryPool<PerformanceTestObject, SampledPerformanceTraits> sampledPool(16);
+    sampledPool.setName("sampled");
+
+    std::cout << "Testing " << iterations << " allocate/deallocate cycles..." << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "  No statistics:      " << churn(plainPool) << " microseconds" << std::endl;
+    std::cout << "  Counters:           " << churn(countedPool) << " microseconds" << std::endl;
+    std::cout << "  Counters + sampled: " << churn(sampledPool) << " microseconds" << std::endl;
+
+    PoolRegistry::instance().forEach([](const PoolStatsSnapshot& stats) {
+        std::cout << "  Pool " << (stats.name ? stats.name : "(unnamed)") << ": "
+                  << stats.allocations << " allocations, high-water mark " << stats.highWaterMark
+                  << ", " << stats.latencySamples << " latency samples" << std::endl;
+        for (size_t i = 0; i < PoolStatsSnapshot::latencyBuckets; ++i) {
+            if (stats.latencyHistogram[i] != 0) {
+                std::cout << "    [" << (1ull << i) << ", " << (2ull << i) << ") ns: "
+                          << stats.latencyHistogram[i] << std::endl;
+            }
+        }
+    });
+}
+
+// Reproduces the pool's former behaviour of writing a flushed message on
+// every failed allocation, to compare against the silent policies
+struct LoggingFailurePolicy : ReturnNullPolicy {
+    static inline std::ofstream* log = nullptr;
+
+    static void* onExhausted(size_t, size_t) {
+        *log << "Pool is full, change the size of the pool" << std::endl;
+        return nullptr;
+    }
+};
+
+struct LoggingFailureTraits : DefaultPoolTraits {
+    using OnFailure = LoggingFailurePolicy;
+};
+
+struct HandlerFailureTraits : DefaultPoolTraits {
+    using OnFailure = HandlerPolicy;
+};
+
+// Throughput of allocate() on an exhausted pool under each failure policy
+void testExhaustionPath() {
+    std::cout << "\n=== Exhaustion Path Test ===" << std::endl;
+
+    const size_t iterations = 1000000;
+    PerformanceTimer timer;
+
+    auto exhaust = [&](auto& pool) {
+        PerformanceTestObject* held = pool.allocate();
+        size_t failures = 0;
+        timer.start();
+        for (size_t i = 0; i < iterations; ++i) {
+            failures += pool.allocate() == nullptr;
+        }
+        timer.stop();
+        pool.deallocate(held);
+        if (failures != iterations) {
+            std::cout << "  Unexpected allocation from a full pool" << std::endl;
+        }
+        return iterations / (timer.getNanoseconds() / 1e9) / 1e6;
+    };
+
+    std::ofstream devNull("/dev/null");
+    LoggingFailurePolicy::log = &devNull;
+    static uint64_t handled = 0;
+    HandlerPolicy::handler = [](PoolFailure, void*, size_t) { ++handled; };
+
+    MemoryPool<PerformanceTestObject, LoggingFailureTraits> loggingPool(1);
+    MemoryPool<PerformanceTestObject> silentPool(1);
+    MemoryPool<PerformanceTestObject, HandlerFailureTraits> handlerPool(1);
+
+    std::cout << "Testing " << iterations << " allocations from a full pool..." << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "  Flushed log line per failure (old behaviour): " << exhaust(loggingPool) << " Mops/s" << std::endl;
+    std::cout << "  ReturnNullPolicy (default):                   " << exhaust(silentPool) << " Mops/s" << std::endl;
+    std::cout << "  HandlerPolicy with a counting handler:        " << exhaust(handlerPool) << " Mops/s" << std::endl;
+    HandlerPolicy::handler = nullptr;
+}
+
+// Compare per-object allocate/deallocate against allocateN/deallocateN
+void testBatchThroughput() {
+    std::cout << "\n=== Batch Allocation Throughput Test ===" << std::endl;
+
+    const size_t objectsPerRun = 1 << 22;
+    MemoryPool<PerformanceTestObject> pool(256);
+    std::vector<PerformanceTestObject*> objects(256);
+    PerformanceTimer timer;
+
+    std::cout << "Allocating and freeing " << objectsPerRun << " objects per batch size..." << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "  Batch   Per-object (Mops/s)   Batched (Mops/s)" << std::endl;
+
+    for (size_t batch = 1; batch <= 256; batch *= 2) {
+        const size_t rounds = objectsPerRun / batch;
+
+        timer.start();
+        for (size_t r = 0; r < rounds; ++r) {
+            for (size_t i = 0; i < batch; ++i) {
+                objects[i] = pool.allocate();
+                objects[i]->id = static_cast<int>(i);
+            }
+            for (size_t i = 0; i < batch; ++i) {
+                pool.deallocate(objects[i]);
+            }
+        }
+        timer.stop();
+        double singleOps = 2.0 * rounds * batch / (timer.getNanoseconds() / 1e9);
+
+        timer.start();
+        for (size_t r = 0; r < rounds; ++r) {
+            pool.allocateN(objects.data(), batch);
+            for (size_t i = 0; i < batch; ++i) {
+                objects[i]->id = static_cast<int>(i);
+            }
+            pool.deallocateN(objects.data(), batch);
+        }
+        timer.stop();
+        double batchOps = 2.0 * rounds * batch / (timer.getNanoseconds() / 1e9);
+
+        std::cout << "  " << std::setw(5) << batch
+                  << "   " << std::setw(19) << singleOps / 1e6
+                  << "   " << std::setw(16) << batchOps / 1e6 << std::endl;
+    }
+}
+
+// Two threads repeatedly update objects that were allocated back to back,
+// so with a natural layout neighbouring objects share cache lines
+template <typename Traits>
+double measureFalseSharing(size_t objectCount, size_t rounds) {
+    MemoryPool<PerformanceTestObject, Traits> pool(objectCount);
+    std::vector<PerformanceTestObject*> objects;
+    for (size_t i = 0; i < objectCount; ++i) {
+        objects.push_back(new (pool.allocate()) PerformanceTestObject(static_cast<int>(i)));
+    }
+
+    PerformanceTimer timer;
+    timer.start();
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < 2; ++t) {
+        threads.emplace_back([&objects, rounds, t]() {
+            for (size_t r = 0; r < rounds; ++r) {
+                for (size_t i = t; i < objects.size(); i += 2) {
+                    volatile double* value = &objects[i]->value;
+                    *value = *value + 1.0;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    timer.stop();
+
+    for (auto* obj : objects) {
+        pool.deallocate(obj);
+    }
+    return timer.getMicroseconds();
+}
+
+void testSlotAlignment() {
+    std::cout << "\n=== Slot Alignment Test ===" << std::endl;
+
+    const size_t objectCount = 64;
+    const size_t rounds = 200000;
+
+    std::cout << "Two threads updating interleaved objects, " << rounds << " rounds..." << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "  Natural layout (" << sizeof(PerformanceTestObject) << "-byte stride): "
+              << measureFalseSharing<DefaultPoolTraits>(objectCount, rounds) << " microseconds" << std::endl;
+    std::cout << "  Cache-line layout: "
+              << measureFalseSharing<CacheAlignedPoolTraits>(objectCount, rounds) << " microseconds" << std::endl;
+}
+
+// Runs `threadCount` threads that each perform `cycles` allocate/deallocate
+// rounds of `batch` objects through the given callables; returns ops/sec
+template <typename Allocate, typename Deallocate>
+double runThreadedChurn(size_t threadCount, size_t cycles, size_t batch,
+                        Allocate allocate, Deallocate deallocate) {
+    std::vector<std::thread> threads;
+    PerformanceTimer timer;
+    timer.start();
+    for (size_t t = 0; t < threadCount; ++t) {
+        threads.emplace_back([&]() {
+            std::vector<PerformanceTestObject*> owned(batch);
+            for (size_t c = 0; c < cycles; ++c) {
+                for (size_t i = 0; i < batch; ++i) {
+                    owned[i] = allocate();
+                }
+                for (size_t i = 0; i < batch; ++i) {
+                    if (owned[i]) {
+                        deallocate(owned[i]);
+                    }
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    timer.stop();
+
+    double seconds = timer.getNanoseconds() / 1e9;
+    return (2.0 * threadCount * cycles * batch) / seconds;
+}
+
+// Compare ConcurrentMemoryPool against a mutex-wrapped MemoryPool
+void testConcurrentScaling() {
+    std::cout << "\n=== Concurrent Scaling Test ===" << std::endl;
+
+    const size_t maxThreads = std::max<size_t>(4, std::thread::hardware_concurrency());
+    const size_t batch = 16;
+    const size_t cycles = 50000;
+
+    std::cout << "Testing " << batch << "-object churn, " << cycles << " cycles per thread..." << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "  Threads   Mutex+MemoryPool (Mops/s)   ConcurrentMemoryPool (Mops/s)" << std::endl;
+
+    for (size_t threads = 1; threads <= maxThreads; threads *= 2) {
+        MemoryPool<PerformanceTestObject> lockedPool(threads * batch);
+        std::mutex poolMutex;
+        double lockedOps = runThreadedChurn(threads, cycles, batch,
+            [&]() {
+                std::lock_guard<std::mutex> lock(poolMutex);
+                return lockedPool.allocate();
+            },
+            [&](PerformanceTestObject* obj) {
+                std::lock_guard<std::mutex> lock(poolMutex);
+                lockedPool.deallocate(obj);
+            });
+
+        ConcurrentMemoryPool<PerformanceTestObject> concurrentPool(threads * batch);
+        double concurrentOps = runThreadedChurn(threads, cycles, batch,
+            [&]() { return concurrentPool.allocate(); },
+            [&](PerformanceTestObject* obj) { concurrentPool.deallocate(obj); });
+
+        std::cout << "  " << std::setw(7) << threads
+                  << "   " << std::setw(25) << lockedOps / 1e6
+                  << "   " << std::setw(29) << concurrentOps / 1e6 << std::endl;
+    }
+}
+
+// Churns a pool down to a quarter of its objects, then sweeps the survivors.
+// Returns the sweep time per object and the number of 4 KB pages the live
+// objects occupy.
+template <typename Traits, typename Sweep>
+std::pair<double, size_t> measureSweepAfterChurn(size_t poolSize, Sweep sweep) {
+    MemoryPool<PerformanceTestObject, Traits> pool(poolSize);
+    std::vector<PerformanceTestObject*> live;
+    for (size_t i = 0; i < poolSize; ++i) {
+        live.push_back(pool.create(static_cast<int>(i), 1.0));
+    }
+
+    // Free three quarters at random, then keep replacing random halves
+    std::mt19937 gen(42);
+    std::shuffle(live.begin(), live.end(), gen);
+    for (size_t i = poolSize / 4; i < poolSize; ++i) {
+        pool.destroy(live[i]);
+    }
+    live.resize(poolSize / 4);
+    for (int round = 0; round < 8; ++round) {
+        std::shuffle(live.begin(), live.end(), gen);
+        for (size_t i = 0; i < live.size() / 2; ++i) {
+            pool.destroy(live[i]);
+        }
+        for (size_t i = 0; i < live.size() / 2; ++i) {
+            live[i] = pool.create(static_cast<int>(i), 1.0);
+        }
+    }
+
+    std::vector<uintptr_t> pages;
+    for (PerformanceTestObject* obj : live) {
+        pages.push_back(reinterpret_cast<uintptr_t>(obj) >> 12);
+    }
+    std::sort(pages.begin(), pages.end());
+    size_t pageCount = static_cast<size_t>(std::unique(pages.begin(), pages.end()) - pages.begin());
+
+    PerformanceTimer timer;
+    double total = 0.0;
+    const int sweeps = 20;
+    timer.start();
+    for (int s = 0; s < sweeps; ++s) {
+        total += sweep(pool, live);
+    }
+    timer.stop();
+    volatile double sink = total;
+    (void)sink;
+
+    for (PerformanceTestObject* obj : live) {
+        pool.destroy(obj);
+    }
+    return {timer.getNanoseconds() / (sweeps * live.size()), pageCount};
+}
+
+void testAllocationOrdering() {
+    std::cout << "\n=== Allocation Ordering Test ===" << std::endl;
+
+    const size_t poolSize = 1 << 18;
+    std::cout << "Sweeping " << poolSize / 4 << " survivors of random churn in a "
+              << poolSize << "-slot pool..." << std::endl;
+
+    auto [lifoNs, lifoPages] = measureSweepAfterChurn<DefaultPoolTraits>(poolSize,
+        [](auto&, const std::vector<PerformanceTestObject*>& live) {
+            double sum = 0.0;
+            for (PerformanceTestObject* obj : live) {
+                sum += obj->value;
+            }
+            return sum;
+        });
+    auto [orderedNs, orderedPages] = measureSweepAfterChurn<AddressOrderedPoolTraits>(poolSize,
+        [](auto& pool, const std::vector<PerformanceTestObject*>&) {
+            double sum = 0.0;
+            pool.forEachLive([&sum](PerformanceTestObject* obj) { sum += obj->value; });
+            return sum;
+        });
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "  LIFO reuse, pointer list:        " << lifoNs << " ns/object, "
+              << lifoPages << " pages touched" << std::endl;
+    std::cout << "  Lowest-slot reuse, forEachLive:  " << orderedNs << " ns/object, "
+              << orderedPages << " pages touched" << std::endl;
+}
+
+// Per-request scratch objects that all die together: freeing them one by
+// one versus dropping the whole pool with releaseAll()
+void testBulkRelease() {
+    std::cout << "\n=== Bulk Release Test ===" << std::endl;
+
+    const size_t temporaries = 500;
+    const size_t requests = 20000;
+    MemoryPool<PerformanceTestObject> pool(temporaries);
+    std::vector<PerformanceTestObject*> objects(temporaries);
+    PerformanceTimer timer;
+
+    std::cout << "Running " << requests << " requests of " << temporaries << " temporaries..." << std::endl;
+
+    timer.start();
+    for (size_t r = 0; r < requests; ++r) {
+        for (size_t i = 0; i < temporaries; ++i) {
+            objects[i] = pool.create(static_cast<int>(i), 1.0);
+        }
+        for (size_t i = 0; i < temporaries; ++i) {
+            pool.deallocate(objects[i]);
+        }
+    }
+    timer.stop();
+    double perObject = timer.getNanoseconds() / requests;
+
+    timer.start();
+    for (size_t r = 0; r < requests; ++r) {
+        for (size_t i = 0; i < temporaries; ++i) {
+            objects[i] = pool.create(static_cast<int>(i), 1.0);
+        }
+        pool.releaseAll();
+    }
+    timer.stop();
+    double bulk = timer.getNanoseconds() / requests;
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "  deallocate() each object: " << perObject << " ns/request" << std::endl;
+    std::cout << "  releaseAll():             " << bulk << " ns/request" << std::endl;
+}
+
+// An index of references to pooled objects, stored as raw pointers or as
+// 32-bit generational handles that are resolved on every access
+void testHandleResolve() {
+    std::cout << "\n=== Generational Handle Test ===" << std::endl;
+
+    const size_t objectCount = 1 << 20;
+    MemoryPool<PerformanceTestObject, HandlePoolTraits> pool(objectCount);
+    using Handle = decltype(pool)::Handle;
+    std::vector<PerformanceTestObject*> pointers(objectCount);
+    std::vector<Handle> handles(objectCount);
+    for (size_t i = 0; i < objectCount; ++i) {
+        handles[i] = pool.allocateHandle();
+        pointers[i] = new (pool.resolve(handles[i])) PerformanceTestObject(static_cast<int>(i), 1.0);
+    }
+
+    // Visit the references in a shuffled order, as a hash index would
+    std::vector<uint32_t> order(objectCount);
+    std::iota(order.begin(), order.end(), 0u);
+    std::shuffle(order.begin(), order.end(), std::mt19937(42));
+
+    PerformanceTimer timer;
+    double sum = 0.0;
+    timer.start();
+    for (uint32_t i : order) {
+        sum += pointers[i]->value;
+    }
+    timer.stop();
+    double pointerNs = timer.getNanoseconds() / objectCount;
+
+    timer.start();
+    for (uint32_t i : order) {
+        sum += pool.resolve(handles[i])->value;
+    }
+    timer.stop();
+    double handleNs = timer.getNanoseconds() / objectCount;
+    volatile double sink = sum;
+    (void)sink;
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "  Raw pointers:  " << pointerNs << " ns/access, "
+              << sizeof(PerformanceTestObject*) * objectCount / 1024 << " KB of references" << std::endl;
+    std::cout << "  Handles:       " << handleNs << " ns/access, "
+              << sizeof(Handle) * objectCount / 1024 << " KB of references" << std::endl;
+}
+
+// A sweep reading two fields of every live object, with whole objects in
+// a MemoryPool versus just those fields in an SoAMemoryPool
+void testStructureOfArrays() {
+    std::cout << "\n=== Structure-of-Arrays Sweep Test ===" << std::endl;
+
+    const size_t objectCount = 1 << 20;
+    MemoryPool<PerformanceTestObject> aosPool(objectCount);
+    SoAMemoryPool<PerformanceTestObject, &PerformanceTestObject::id, &PerformanceTestObject::value> soaPool(objectCount);
+    std::vector<PerformanceTestObject*> objects;
+    for (size_t i = 0; i < objectCount; ++i) {
+        objects.push_back(aosPool.create(static_cast<int>(i % 100), 0.5));
+        soaPool.create(*objects.back());
+    }
+
+    // Free a random tenth of both
+    std::mt19937 gen(42);
+    std::vector<size_t> order(objectCount);
+    std::iota(order.begin(), order.end(), size_t{0});
+    std::shuffle(order.begin(), order.end(), gen);
+    for (size_t i = 0; i < objectCount / 10; ++i) {
+        aosPool.destroy(objects[order[i]]);
+        objects[order[i]] = nullptr;
+        soaPool.deallocate(order[i]);
+    }
+    objects.erase(std::remove(objects.begin(), objects.end(), nullptr), objects.end());
+
+    const int sweeps = 20;
+    PerformanceTimer timer;
+    double aosSum = 0.0;
+    timer.start();
+    for (int s = 0; s < sweeps; ++s) {
+        for (PerformanceTestObject* obj : objects) {
+            aosSum += obj->id * obj->value;
+        }
+    }
+    timer.stop();
+    double aosNs = timer.getNanoseconds() / (sweeps * objects.size());
+
+    // Freed slots read as zero, so the whole column can be summed unmasked
+    const int* ids = soaPool.column<&PerformanceTestObject::id>();
+    const double* values = soaPool.column<&PerformanceTestObject::value>();
+    double soaSum = 0.0;
+    timer.start();
+    for (int s = 0; s < sweeps; ++s) {
+        for (size_t i = 0; i < objectCount; ++i) {
+            soaSum += ids[i] * values[i];
+        }
+    }
+    timer.stop();
+    double soaNs = timer.getNanoseconds() / (sweeps * objects.size());
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "Summing id * value over " << objects.size() << " live objects (results "
+              << (aosSum == soaSum ? "match" : "differ") << ")..." << std::endl;
+    std::cout << "  MemoryPool (" << sizeof(PerformanceTestObject) << " B/object):   " << aosNs << " ns/object" << std::endl;
+    std::cout << "  SoAMemoryPool (" << sizeof(int) + sizeof(double) << " B/object): " << soaNs << " ns/object" << std::endl;
+}
+
+void testEpochReclamation() {
+    std::cout << "\n=== Epoch Reclamation Test ===" << std::endl;
+
+    const size_t poolSize = 4096;
+    const int iterations = 2000000;
+    ConcurrentMemoryPool<PerformanceTestObject> immediatePool(poolSize);
+    EpochMemoryPool<PerformanceTestObject> epochPool(poolSize);
+    PerformanceTimer timer;
+
+    timer.start();
+    for (int i = 0; i < iterations; ++i) {
+        immediatePool.deallocate(immediatePool.allocate());
+    }
+    timer.stop();
+    double immediateNs = timer.getNanoseconds() / iterations;
+
+    // Retired slots come back in batches once the epoch has moved on
+    timer.start();
+    for (int i = 0; i < iterations; ++i) {
+        epochPool.retire(epochPool.allocate());
+    }
+    timer.stop();
+    double retireNs = timer.getNanoseconds() / iterations;
+
+    timer.start();
+    for (int i = 0; i < iterations; ++i) {
+        EpochMemoryPool<PerformanceTestObject>::Guard guard(epochPool);
+    }
+    timer.stop();
+    double guardNs = timer.getNanoseconds() / iterations;
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "Single thread, " << iterations << " operations..." << std::endl;
+    std::cout << "  ConcurrentMemoryPool allocate + deallocate: " << immediateNs << " ns" << std::endl;
+    std::cout << "  EpochMemoryPool allocate + retire:          " << retireNs << " ns" << std::endl;
+    std::cout << "  EpochMemoryPool enter + exit:               " << guardNs << " ns" << std::endl;
+    std::cout << "  Epochs advanced: " << epochPool.getEpoch() << std::endl;
+}
+
+// Minimal lazy task; HeapFrame promises use the global operator new
+struct HeapFrame {};
+
+template <typename FrameBase>
+struct BenchTask {
+    struct promise_type : FrameBase {
+        int result = 0;
+
+        BenchTask get_return_object() { return BenchTask(std::coroutine_handle<promise_type>::from_promise(*this)); }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+        void return_value(int value) { result = value; }
+        void unhandled_exception() { std::terminate(); }
+    };
+
+    explicit BenchTask(std::coroutine_handle<promise_type> handle) : handle(handle) {}
+    BenchTask(BenchTask&& other) noexcept : handle(std::exchange(other.handle, {})) {}
+    ~BenchTask() {
+        if (handle) {
+            handle.destroy();
+        }
+    }
+
+    int get() {
+        handle.resume();
+        return handle.promise().result;
+    }
+
+    std::coroutine_handle<promise_type> handle;
+};
+
+// noinline keeps the compiler from eliding the frame allocation
+template <typename FrameBase>
+__attribute__((noinline)) BenchTask<FrameBase> benchStep(int value) {
+    co_return value + 1;
+}
+
+template <typename FrameBase>
+double measureCoroutineSpawns(int count, int batch) {
+    std::vector<BenchTask<FrameBase>> live;
+    live.reserve(batch);
+    long long sum = 0;
+    PerformanceTimer timer;
+    timer.start();
+    for (int i = 0; i < count; i += batch) {
+        for (int j = 0; j < batch; ++j) {
+            live.push_back(benchStep<FrameBase>(j));
+        }
+        for (auto& task : live) {
+            sum += task.get();
+        }
+        live.clear();
+    }
+    timer.stop();
+    volatile long long sink = sum;
+    (void)sink;
+    return timer.getNanoseconds() / count;
+}
+
+void testCoroutineFrames() {
+    std::cout << "\n=== Coroutine Frame Allocation Test ===" << std::endl;
+
+    const int count = 2000000;
+    std::cout << std::fixed << std::setprecision(2);
+    for (int batch : {1, 64, 1024}) {
+        double heapNs = measureCoroutineSpawns<HeapFrame>(count, batch);
+        double concurrentNs = measureCoroutineSpawns<PooledCoroutineFrame<>>(count, batch);
+        double threadLocalNs = measureCoroutineSpawns<PooledCoroutineFrame<ThreadLocalFrameSource<>>>(count, batch);
+        std::cout << "Create, resume and destroy, " << batch << " live at a time..." << std::endl;
+        std::cout << "  operator new:           " << heapNs << " ns/coroutine" << std::endl;
+        std::cout << "  ConcurrentFrameSource:  " << concurrentNs << " ns/coroutine" << std::endl;
+        std::cout << "  ThreadLocalFrameSource: " << threadLocalNs << " ns/coroutine" << std::endl;
+    }
+}
+
 int main() {
     std::cout << "MemoryPool Performance Test Suite" << std::endl;
     std::cout << "=================================" << std::endl;
@@ -336,6 +1445,24 @@ int main() {
         testMixedOperationsLatency();
         compareWithStandardAllocation();
         testDifferentObjectSizes();
+        testHardwareCounters();
+        testConcurrentScaling();
+        testPoolStartup();
+#if defined(__unix__) || defined(__APPLE__)
+        testBackingPageFaults();
+#endif
+        testSlotAlignment();
+        testBatchThroughput();
+        testAllocationOrdering();
+        testBulkRelease();
+        testHandleResolve();
+        testStructureOfArrays();
+        testCoroutineFrames();
+        testEpochReclamation();
+        testContainerAllocators();
+        testStaticPool();
+        testPoolStatistics();
+        testExhaustionPath();
         
         std::cout << "\n=== Performance Test Complete ===" << std::endl;
     } catch (const std::exception& e) {